@@ -0,0 +1,127 @@
+// Integration tests for the DelegateMQ blocking asynchronous delegates
+//
+// All tests run within the IntegrationTest thread context. Each test creates its
+// own destination thread and blocks it to control when the target is invoked.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+static atomic<int> invokeCount;
+
+// Callback invoked on the destination thread. Returns the value doubled.
+static int DoubleCb(int value)
+{
+	invokeCount++;
+	return value * 2;
+}
+
+// Callback invoked on the destination thread. Sets the outgoing argument after a delay.
+static int SlowCb(int& value)
+{
+	invokeCount++;
+	this_thread::sleep_for(milliseconds(150));
+	value = 7;
+	return 3;
+}
+
+// Callback invoked on the destination thread. Blocks the thread until released.
+static void BlockCb()
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is blocked.
+static void Block(Thread& thread)
+{
+	MakeDelegate(&BlockCb, thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Wait for a thread to invoke all queued messages
+static void Flush(Thread& thread)
+{
+	auto retVal = MakeDelegate(std::function<void()>([]() {}), thread, milliseconds(1000)).AsyncInvoke();
+	CHECK(retVal.has_value());
+}
+
+// Test a call completed within the timeout returns the target return value
+TEST_CASE("AsyncWait_IT - Complete")
+{
+	Thread thread("AsyncWaitThread");
+	thread.CreateThread();
+	invokeCount = 0;
+
+	auto delegate = MakeDelegate(&DoubleCb, thread, milliseconds(1000));
+	auto retVal = delegate.AsyncInvoke(4);
+	CHECK(retVal.has_value());
+	if (retVal.has_value())
+		CHECK(retVal.value() == 8);
+	CHECK(delegate.IsSuccess());
+	CHECK(invokeCount == 1);
+
+	thread.ExitThread();
+}
+
+// Test a call not started before the timeout is withdrawn and never invoked
+TEST_CASE("AsyncWait_IT - TimeoutBeforeInvoke")
+{
+	Thread thread("AsyncWaitThread");
+	thread.CreateThread();
+	invokeCount = 0;
+
+	auto delegate = MakeDelegate(&DoubleCb, thread, milliseconds(50));
+	Block(thread);
+	auto retVal = delegate.AsyncInvoke(4);
+	CHECK(!retVal.has_value());
+	CHECK(!delegate.IsSuccess());
+
+	// The withdrawn message is discarded when the thread resumes
+	releaseThread.SetSignal();
+	Flush(thread);
+	CHECK(invokeCount == 0);
+
+	// The next call succeeds
+	retVal = delegate.AsyncInvoke(5);
+	CHECK(retVal.has_value());
+	CHECK(invokeCount == 1);
+
+	thread.ExitThread();
+}
+
+// Test a timeout expiring while the target is executing waits for the target to
+// return, since the arguments may reference caller data
+TEST_CASE("AsyncWait_IT - TimeoutDuringInvoke")
+{
+	Thread thread("AsyncWaitThread");
+	thread.CreateThread();
+	invokeCount = 0;
+
+	auto delegate = MakeDelegate(&SlowCb, thread, milliseconds(50));
+	int value = 0;
+	auto start = steady_clock::now();
+	auto retVal = delegate.AsyncInvoke(value);
+	auto elapsed = steady_clock::now() - start;
+
+	// The call completed; the outgoing argument and return value are valid
+	CHECK(elapsed >= milliseconds(140));
+	CHECK(invokeCount == 1);
+	CHECK(value == 7);
+	CHECK(delegate.IsSuccess());
+	CHECK(retVal.has_value());
+	if (retVal.has_value())
+		CHECK(retVal.value() == 3);
+
+	thread.ExitThread();
+}
+
+// Dummy function to force linker to keep the code in this file
+void AsyncWait_IT_ForceLink() { }
@@ -0,0 +1,264 @@
+// Integration tests for the DelegateMQ asynchronous delegates
+//
+// All tests run within the IntegrationTest thread context. Each test creates its
+// own destination thread and blocks it while queuing messages, so the queue
+// contents are known when the thread resumes.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static SignalThread signalThread;
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+static vector<int> values;
+static mutex mtx;
+
+// Callback invoked on the destination thread. Saves the value.
+static void ValueCb(int value)
+{
+	lock_guard<mutex> lock(mtx);
+	values.push_back(value);
+	signalThread.SetSignal();
+}
+
+// Callback invoked on the destination thread. Blocks the thread until released.
+static void BlockCb()
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is
+// blocked, so messages queued afterwards cannot be invoked ahead of BlockCb.
+static void Block(Thread& thread)
+{
+	MakeDelegate(&BlockCb, thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Get a copy of the saved values
+static vector<int> GetValues()
+{
+	lock_guard<mutex> lock(mtx);
+	return values;
+}
+
+// Clear the saved values
+static void ClearValues()
+{
+	lock_guard<mutex> lock(mtx);
+	values.clear();
+}
+
+// Test a burst of calls to a conflating delegate delivers only the latest value
+TEST_CASE("DelegateAsync_IT - ConflateBurst")
+{
+	Thread thread("ConflateThread");
+	thread.CreateThread();
+	ClearValues();
+
+	auto delegate = MakeDelegate(&ValueCb, thread);
+	delegate.SetConflate(true);
+
+	// Block the thread, then queue a burst of calls
+	Block(thread);
+	for (int i = 1; i <= 100; i++)
+		delegate(i);
+
+	// Only one conflated message is queued behind the blocking message
+	auto stats = thread.GetStats();
+	CHECK(stats.enqueued[static_cast<size_t>(Priority::NORMAL)] == 2);
+
+	releaseThread.SetSignal();
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(!signalThread.WaitForSignal(50));
+	CHECK(GetValues() == vector<int>{ 100 });
+
+	// The next call queues a new message
+	delegate(101);
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 100, 101 });
+
+	thread.ExitThread();
+}
+
+// Test a conflated message discarded without being invoked allows the next call
+// to queue a new message
+TEST_CASE("DelegateAsync_IT - ConflateDiscarded")
+{
+	Thread thread("ConflateThread");
+	thread.CreateThread();
+	ClearValues();
+
+	auto delegate = MakeDelegate(&ValueCb, thread);
+	delegate.SetConflate(true);
+	delegate.SetLifetime(milliseconds(10));
+
+	// Queued message expires while the thread is blocked
+	Block(thread);
+	delegate(1);
+	this_thread::sleep_for(milliseconds(50));
+	releaseThread.SetSignal();
+	CHECK(!signalThread.WaitForSignal(100));
+	CHECK(GetValues().empty());
+	CHECK(thread.GetStats().expired[static_cast<size_t>(Priority::NORMAL)] == 1);
+
+	// Expired message no longer blocks the next call
+	delegate(2);
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 2 });
+
+	// Queued message is discarded by thread exit. The low priority message
+	// waits behind the exit message queued while the thread is blocked.
+	delegate.SetLifetime(std::nullopt);
+	delegate.SetPriority(Priority::LOW);
+	Block(thread);
+	delegate(3);
+	std::thread releaser([]() {
+		this_thread::sleep_for(milliseconds(50));
+		releaseThread.SetSignal();
+	});
+	thread.ExitThread();
+	releaser.join();
+	CHECK(GetValues() == vector<int>{ 2 });
+
+	// Discarded message no longer blocks the next call
+	thread.CreateThread();
+	delegate(4);
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 2, 4 });
+
+	thread.ExitThread();
+}
+
+// Callback invoked on the destination thread. Saves the negated value.
+static void NegateCb(int value)
+{
+	ValueCb(-value);
+}
+
+// Test the shared invoker is created by the first call and recreated after a rebind
+TEST_CASE("DelegateAsync_IT - LazyInvoker")
+{
+	Thread thread("InvokerThread");
+	thread.CreateThread();
+	ClearValues();
+
+	// The first call creates the invoker
+	auto delegate = MakeDelegate(&ValueCb, thread);
+	delegate(1);
+	CHECK(signalThread.WaitForSignal(500));
+
+	// A rebound delegate invokes the new target
+	delegate.Bind(&NegateCb, thread);
+	delegate(2);
+	CHECK(signalThread.WaitForSignal(500));
+
+	// A copy made before the first call creates its own invoker
+	auto other = MakeDelegate(&ValueCb, thread);
+	auto copy = other;
+	copy(3);
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 1, -2, 3 });
+
+	thread.ExitThread();
+}
+
+// Run a function on a thread and wait for it to return
+static void RunOn(Thread& thread, std::function<void()> func)
+{
+	auto retVal = MakeDelegate(func, thread, milliseconds(1000)).AsyncInvoke();
+	CHECK(retVal.has_value());
+}
+
+// Get the number of normal priority messages queued to a thread
+static uint64_t GetEnqueued(Thread& thread)
+{
+	return thread.GetStats().enqueued[static_cast<size_t>(Priority::NORMAL)];
+}
+
+// Test a call made on the destination thread is queued by default and invoked
+// synchronously without queuing when inline mode is enabled
+TEST_CASE("DelegateAsync_IT - InlineSameThread")
+{
+	Thread thread("InlineThread");
+	thread.CreateThread();
+	ClearValues();
+
+	auto delegate = MakeDelegate(&ValueCb, thread);
+	CHECK(!delegate.GetInlineSameThread());
+
+	// Disabled by default; the call is queued behind the running target
+	uint64_t enqueued = 0;
+	RunOn(thread, [&]() {
+		enqueued = GetEnqueued(thread);
+		delegate(1);
+		CHECK(GetValues().empty());
+		CHECK(GetEnqueued(thread) == enqueued + 1);
+	});
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 1 });
+
+	// Enabled; the target runs before the call returns and nothing is queued
+	delegate.SetInlineSameThread(true);
+	CHECK(delegate.GetInlineSameThread());
+	RunOn(thread, [&]() {
+		enqueued = GetEnqueued(thread);
+		delegate(2);
+		CHECK(GetValues() == vector<int>{ 1, 2 });
+		CHECK(GetEnqueued(thread) == enqueued);
+	});
+	CHECK(signalThread.WaitForSignal(500));
+
+	// A call from another thread is still queued
+	Block(thread);
+	delegate(3);
+	CHECK(GetValues() == vector<int>{ 1, 2 });
+	releaseThread.SetSignal();
+	CHECK(signalThread.WaitForSignal(500));
+	CHECK(GetValues() == vector<int>{ 1, 2, 3 });
+
+	// Copies keep the mode
+	auto copy = delegate;
+	CHECK(copy.GetInlineSameThread());
+
+	thread.ExitThread();
+}
+
+// Callback invoked on the destination thread. Returns the value doubled.
+static int DoubleCb(int value)
+{
+	return value * 2;
+}
+
+// Test a future requested on the destination thread completes before the call
+// returns, since a queued call could never complete while the caller waits
+TEST_CASE("DelegateAsync_IT - FutureSameThread")
+{
+	Thread thread("InlineThread");
+	thread.CreateThread();
+
+	auto delegate = MakeDelegate(&DoubleCb, thread);
+	CHECK(!delegate.GetInlineSameThread());
+	RunOn(thread, [&]() {
+		auto enqueued = GetEnqueued(thread);
+		auto future = delegate.AsyncInvokeFuture(4);
+		CHECK(future.IsReady());
+		CHECK(GetEnqueued(thread) == enqueued);
+		auto value = future.Get(milliseconds(0));
+		CHECK(value.has_value());
+		if (value.has_value())
+			CHECK(value.value() == 8);
+	});
+
+	thread.ExitThread();
+}
+
+// Dummy function to force linker to keep the code in this file
+void DelegateAsync_IT_ForceLink() { }
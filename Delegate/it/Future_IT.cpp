@@ -0,0 +1,177 @@
+// Integration tests for the DelegateMQ Future return values
+//
+// All tests run within the IntegrationTest thread context. Each test creates its
+// own destination thread and blocks it to control when the target completes.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+
+// Callback invoked on the destination thread. Returns the value doubled.
+static int DoubleCb(int value)
+{
+	return value * 2;
+}
+
+// Callback invoked on the destination thread. Blocks the thread until released.
+static void BlockCb()
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is blocked.
+static void Block(Thread& thread)
+{
+	MakeDelegate(&BlockCb, thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Test Get() with a timeout before and after the target completes
+TEST_CASE("Future_IT - GetTimeout")
+{
+	Thread thread("FutureThread");
+	thread.CreateThread();
+
+	auto delegate = MakeDelegate(&DoubleCb, thread);
+	Block(thread);
+	auto future = delegate.AsyncInvokeFuture(21);
+	CHECK(future.IsValid());
+	CHECK(!future.IsReady());
+
+	// Timeout leaves the future valid
+	auto value = future.Get(milliseconds(50));
+	CHECK(!value.has_value());
+	CHECK(future.IsValid());
+
+	releaseThread.SetSignal();
+	value = future.Get(milliseconds(1000));
+	CHECK(value.has_value());
+	if (value.has_value())
+		CHECK(value.value() == 42);
+
+	// A successful Get() releases the state
+	CHECK(!future.IsValid());
+	CHECK(!future.Get(milliseconds(10)).has_value());
+
+	// A void target returns the completion status
+	auto voidFuture = MakeDelegate(std::function<void()>([]() {}), thread).AsyncInvokeFuture();
+	CHECK(voidFuture.Get(milliseconds(1000)));
+
+	thread.ExitThread();
+}
+
+// Test a continuation attached before and after the target completes
+TEST_CASE("Future_IT - Then")
+{
+	Thread thread("FutureThread");
+	thread.CreateThread();
+
+	auto delegate = MakeDelegate(&DoubleCb, thread);
+
+	// Attached before completion; invoked on the destination thread
+	SignalThread continued;
+	int thenValue = 0;
+	std::thread::id thenThread;
+	Block(thread);
+	auto future = delegate.AsyncInvokeFuture(5);
+	CHECK(future.Then([&](int& value) {
+		thenValue = value;
+		thenThread = this_thread::get_id();
+		continued.SetSignal();
+	}));
+	releaseThread.SetSignal();
+	CHECK(continued.WaitForSignal(1000));
+	CHECK(thenValue == 10);
+	CHECK(thenThread == thread.GetThreadId());
+
+	// The value remains available after the continuation
+	auto value = future.Get(milliseconds(1000));
+	CHECK(value.has_value());
+	if (value.has_value())
+		CHECK(value.value() == 10);
+
+	// Attached after completion; invoked immediately on the calling thread
+	future = delegate.AsyncInvokeFuture(7);
+	CHECK(future.Wait(milliseconds(1000)));
+	thenValue = 0;
+	CHECK(future.Then([&](int& value) {
+		thenValue = value;
+		thenThread = this_thread::get_id();
+	}));
+	CHECK(thenValue == 14);
+	CHECK(thenThread == this_thread::get_id());
+
+	// An invalid future does not register a continuation
+	Future<int> invalid;
+	CHECK(!invalid.Then([](int&) {}));
+
+	thread.ExitThread();
+}
+
+// Test a future whose message is discarded by the exiting thread never completes
+TEST_CASE("Future_IT - ThreadExit")
+{
+	Thread thread("FutureThread");
+	thread.CreateThread();
+
+	auto delegate = MakeDelegate(&DoubleCb, thread);
+	delegate.SetPriority(Priority::LOW);
+
+	// The queued low priority message waits behind the exit message
+	Block(thread);
+	auto future = delegate.AsyncInvokeFuture(1);
+	std::thread releaser([]() {
+		this_thread::sleep_for(milliseconds(50));
+		releaseThread.SetSignal();
+	});
+	thread.ExitThread();
+	releaser.join();
+
+	CHECK(future.IsValid());
+	CHECK(!future.IsReady());
+	CHECK(!future.Get(milliseconds(50)).has_value());
+}
+
+// Test WhenAll() with one future complete and another still running
+TEST_CASE("Future_IT - WhenAllPartial")
+{
+	Thread thread1("FutureThread1");
+	Thread thread2("FutureThread2");
+	thread1.CreateThread();
+	thread2.CreateThread();
+
+	auto delegate1 = MakeDelegate(&DoubleCb, thread1);
+	auto delegate2 = MakeDelegate(&DoubleCb, thread2);
+
+	Block(thread2);
+	auto future1 = delegate1.AsyncInvokeFuture(1);
+	auto future2 = delegate2.AsyncInvokeFuture(2);
+
+	// The timeout is the total wait, not the wait per future
+	auto start = steady_clock::now();
+	CHECK(!WhenAll(milliseconds(100), future1, future2));
+	auto elapsed = steady_clock::now() - start;
+	CHECK(elapsed < milliseconds(500));
+	CHECK(future1.IsReady());
+	CHECK(!future2.IsReady());
+
+	releaseThread.SetSignal();
+	CHECK(WhenAll(milliseconds(1000), future1, future2));
+	CHECK(future1.Get().value() == 2);
+	CHECK(future2.Get().value() == 4);
+
+	thread1.ExitThread();
+	thread2.ExitThread();
+}
+
+// Dummy function to force linker to keep the code in this file
+void Future_IT_ForceLink() { }
@@ -0,0 +1,703 @@
+// Integration tests for the DelegateMQ MulticastDelegate container
+//
+// All tests run within the IntegrationTest thread context.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include <cstring>
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Subscriber counting its invocations. Each instance binds a distinct delegate.
+class Counter
+{
+public:
+	void Inc(int value) { count += value; }
+	int count = 0;
+};
+
+// Number of delegates that switches the container to the hash index
+static const int THRESHOLD = DMQ_MULTICAST_INDEX_THRESHOLD;
+
+// Test duplicate delegates are removed one at a time while indexed
+TEST_CASE("MulticastDelegate_IT - IndexDuplicates")
+{
+	const int COUNT = THRESHOLD + 8;
+	vector<Counter> counters(COUNT);
+	MulticastDelegate<void(int)> multicast;
+	for (auto& counter : counters)
+		multicast += MakeDelegate(&counter, &Counter::Inc);
+
+	// Three more copies of the first delegate
+	auto duplicate = MakeDelegate(&counters[0], &Counter::Inc);
+	for (int i = 0; i < 3; i++)
+		multicast += duplicate;
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT + 3));
+
+	multicast(1);
+	CHECK(counters[0].count == 4);
+	CHECK(counters[1].count == 1);
+
+	// Each Remove() removes a single copy
+	for (int i = 3; i >= 0; i--)
+	{
+		multicast -= duplicate;
+		CHECK(multicast.Size() == static_cast<size_t>(COUNT - 1 + i));
+		CHECK(multicast.Contains(duplicate) == (i > 0));
+
+		counters[0].count = 0;
+		multicast(1);
+		CHECK(counters[0].count == i);
+	}
+
+	// Removing a missing delegate changes nothing
+	multicast -= duplicate;
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT - 1));
+}
+
+// Test inserting and removing across the index threshold
+TEST_CASE("MulticastDelegate_IT - IndexThreshold")
+{
+	const int COUNT = THRESHOLD * 3;
+	vector<Counter> counters(COUNT);
+	MulticastDelegate<void(int)> multicast;
+
+	auto checkAll = [&](int first, int last) {
+		// Delegates [first, last) are registered
+		for (int i = 0; i < COUNT; i++)
+		{
+			counters[i].count = 0;
+			CHECK(multicast.Contains(MakeDelegate(&counters[i], &Counter::Inc)) == (i >= first && i < last));
+		}
+		multicast(1);
+		int invoked = 0;
+		for (int i = 0; i < COUNT; i++)
+			invoked += counters[i].count;
+		CHECK(invoked == last - first);
+		CHECK(multicast.Size() == static_cast<size_t>(last - first));
+	};
+
+	// Grow past the threshold one delegate at a time
+	for (int i = 0; i < COUNT; i++)
+	{
+		multicast += MakeDelegate(&counters[i], &Counter::Inc);
+		if (i == THRESHOLD - 2 || i == THRESHOLD - 1 || i == THRESHOLD || i == COUNT - 1)
+			checkAll(0, i + 1);
+	}
+
+	// Shrink from the front below the threshold. Removed slots are reclaimed in bulk.
+	for (int i = 0; i < COUNT - THRESHOLD / 2; i++)
+	{
+		multicast -= MakeDelegate(&counters[i], &Counter::Inc);
+		if (i == COUNT / 2 || i == COUNT - THRESHOLD - 1 || i == COUNT - THRESHOLD)
+			checkAll(i + 1, COUNT);
+	}
+	checkAll(COUNT - THRESHOLD / 2, COUNT);
+
+	// Grow past the threshold again
+	for (int i = 0; i < COUNT - THRESHOLD / 2; i++)
+		multicast += MakeDelegate(&counters[i], &Counter::Inc);
+	checkAll(0, COUNT);
+
+	multicast.Clear();
+	checkAll(0, 0);
+}
+
+// Test a delegate bound to an expired shared pointer is found while indexed
+TEST_CASE("MulticastDelegate_IT - IndexExpiredSharedPtr")
+{
+	vector<Counter> counters(THRESHOLD);
+	MulticastDelegate<void(int)> multicast;
+	for (auto& counter : counters)
+		multicast += MakeDelegate(&counter, &Counter::Inc);
+
+	auto expiring = make_shared<Counter>();
+	auto other = make_shared<Counter>();
+	auto expiringDelegate = MakeDelegate(expiring, &Counter::Inc);
+	auto otherDelegate = MakeDelegate(other, &Counter::Inc);
+	multicast += expiringDelegate;
+	multicast += otherDelegate;
+	CHECK(multicast.Size() == static_cast<size_t>(THRESHOLD + 2));
+
+	// The hash is unchanged once the object expires
+	auto hash = expiringDelegate.Hash();
+	expiring.reset();
+	CHECK(expiringDelegate.Hash() == hash);
+	CHECK(multicast.Contains(expiringDelegate));
+	multicast(1);
+
+	// Expired delegates bound to different objects are not equal
+	other.reset();
+	CHECK(!(expiringDelegate == otherDelegate));
+
+	multicast -= expiringDelegate;
+	CHECK(!multicast.Contains(expiringDelegate));
+	CHECK(multicast.Contains(otherDelegate));
+	multicast -= otherDelegate;
+	CHECK(multicast.Size() == static_cast<size_t>(THRESHOLD));
+}
+
+// Subscriber modifying the container it is invoked by
+class Modifier
+{
+public:
+	Modifier(MulticastDelegate<void(int)>& multicast, vector<Counter>& counters, Counter& added) :
+		m_multicast(multicast), m_counters(counters), m_added(added) {}
+
+	// Remove this delegate
+	void RemoveSelf(int) { m_multicast -= MakeDelegate(this, &Modifier::RemoveSelf); }
+
+	// Remove every odd counter and insert another delegate
+	void Modify(int)
+	{
+		for (size_t i = 1; i < m_counters.size(); i += 2)
+			m_multicast -= MakeDelegate(&m_counters[i], &Counter::Inc);
+		m_multicast += MakeDelegate(&m_added, &Counter::Inc);
+	}
+
+private:
+	MulticastDelegate<void(int)>& m_multicast;
+	vector<Counter>& m_counters;
+	Counter& m_added;
+};
+
+// Test removing and inserting delegates during a broadcast while indexed
+TEST_CASE("MulticastDelegate_IT - IndexRemoveDuringBroadcast")
+{
+	const int COUNT = THRESHOLD * 2;
+	vector<Counter> counters(COUNT);
+	Counter added;
+	MulticastDelegate<void(int)> multicast;
+	Modifier modifier(multicast, counters, added);
+
+	auto removeSelf = MakeDelegate(&modifier, &Modifier::RemoveSelf);
+	auto modify = MakeDelegate(&modifier, &Modifier::Modify);
+	multicast += removeSelf;
+	multicast += modify;
+	for (auto& counter : counters)
+		multicast += MakeDelegate(&counter, &Counter::Inc);
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT + 2));
+
+	multicast(1);
+
+	// Removed delegates are not invoked; the inserted delegate is
+	for (int i = 0; i < COUNT; i++)
+		CHECK(counters[i].count == (i % 2 == 0 ? 1 : 0));
+	CHECK(added.count == 1);
+	CHECK(!multicast.Contains(removeSelf));
+	CHECK(multicast.Contains(modify));
+	CHECK(multicast.Contains(MakeDelegate(&added, &Counter::Inc)));
+	CHECK(!multicast.Contains(MakeDelegate(&counters[1], &Counter::Inc)));
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT / 2 + 2));
+
+	// Index is consistent after the broadcast
+	multicast -= modify;
+	multicast -= MakeDelegate(&added, &Counter::Inc);
+	for (int i = 0; i < COUNT; i += 2)
+		multicast -= MakeDelegate(&counters[i], &Counter::Inc);
+	CHECK(multicast.Empty());
+}
+
+// Subscriber invoked on a destination thread. Accessed only by that thread
+// until the test waits for the thread.
+class AsyncSubscriber
+{
+public:
+	void Value(int value) { values.push_back(value); }
+	void Text(const string& text) { texts.push_back(text); }
+	void Ref(int& value) { values.push_back(value); }
+
+	vector<int> values;
+	vector<string> texts;
+};
+
+// Wait for a thread to invoke all queued messages
+static void Flush(Thread& thread)
+{
+	auto retVal = MakeDelegate(std::function<void()>([]() {}), thread, milliseconds(1000)).AsyncInvoke();
+	CHECK(retVal.has_value());
+}
+
+// Get the number of messages queued to a thread
+static uint64_t GetEnqueued(Thread& thread)
+{
+	auto stats = thread.GetStats();
+	uint64_t enqueued = 0;
+	for (auto count : stats.enqueued)
+		enqueued += count;
+	return enqueued;
+}
+
+// Test a broadcast to several async subscribers on one thread queues one message
+TEST_CASE("MulticastDelegate_IT - FusedBroadcast")
+{
+	const int COUNT = 5;
+	Thread thread1("FusionThread1");
+	Thread thread2("FusionThread2");
+	thread1.CreateThread();
+	thread2.CreateThread();
+
+	AsyncSubscriber subscribers[COUNT];
+	AsyncSubscriber other;
+	MulticastDelegate<void(int)> valueMulticast;
+	MulticastDelegate<void(const string&)> textMulticast;
+	for (auto& subscriber : subscribers)
+	{
+		valueMulticast += MakeDelegate(&subscriber, &AsyncSubscriber::Value, thread1);
+		textMulticast += MakeDelegate(&subscriber, &AsyncSubscriber::Text, thread1);
+	}
+	valueMulticast += MakeDelegate(&other, &AsyncSubscriber::Value, thread2);
+
+	// One message per destination thread
+	valueMulticast(7);
+	textMulticast("fused");
+	CHECK(GetEnqueued(thread1) == 2);
+	CHECK(GetEnqueued(thread2) == 1);
+
+	// Each subscriber is invoked with the shared argument copy
+	Flush(thread1);
+	Flush(thread2);
+	for (auto& subscriber : subscribers)
+	{
+		CHECK(subscriber.values == vector<int>{ 7 });
+		CHECK(subscriber.texts == vector<string>{ "fused" });
+	}
+	CHECK(other.values == vector<int>{ 7 });
+
+	thread1.ExitThread();
+	thread2.ExitThread();
+}
+
+// Test a broadcast with a non-const reference argument queues one message per subscriber
+TEST_CASE("MulticastDelegate_IT - UnfusedReference")
+{
+	const int COUNT = 5;
+	Thread thread("FusionThread");
+	thread.CreateThread();
+
+	AsyncSubscriber subscribers[COUNT];
+	MulticastDelegate<void(int&)> multicast;
+	for (auto& subscriber : subscribers)
+		multicast += MakeDelegate(&subscriber, &AsyncSubscriber::Ref, thread);
+
+	int value = 9;
+	multicast(value);
+	CHECK(GetEnqueued(thread) == COUNT);
+
+	Flush(thread);
+	for (auto& subscriber : subscribers)
+		CHECK(subscriber.values == vector<int>{ 9 });
+
+	thread.ExitThread();
+}
+
+// Order in which subscribers were invoked
+static vector<int> order;
+static mutex orderMtx;
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+
+// Create a subscriber saving its identifier to the invoked order
+static std::function<void(int)> Recorder(int id)
+{
+	return [id](int) {
+		lock_guard<mutex> lock(orderMtx);
+		order.push_back(id);
+	};
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is blocked.
+static void Block(Thread& thread)
+{
+	MakeDelegate(std::function<void()>([]() {
+		blockedThread.SetSignal();
+		releaseThread.WaitForSignal(2000);
+	}), thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Test a broadcast mixing fused, unfused and synchronous subscribers on one thread
+// invokes the subscribers in subscription order
+TEST_CASE("MulticastDelegate_IT - FusedOrder")
+{
+	Thread thread("FusionThread");
+	thread.CreateThread();
+	{
+		lock_guard<mutex> lock(orderMtx);
+		order.clear();
+	}
+
+	MulticastDelegate<void(int)> multicast;
+	multicast += MakeDelegate(Recorder(1), thread);
+	multicast += MakeDelegate(Recorder(2), thread);
+
+	// Conflating delegates are not fused
+	auto conflated = MakeDelegate(Recorder(3), thread);
+	conflated.SetConflate(true);
+	multicast += conflated;
+	multicast += MakeDelegate(Recorder(4), thread);
+
+	// Synchronous subscriber sending its own message to the thread
+	multicast += MakeDelegate(std::function<void(int)>([&thread](int value) {
+		MakeDelegate(Recorder(5), thread)(value);
+	}));
+	multicast += MakeDelegate(Recorder(6), thread);
+	multicast += MakeDelegate(Recorder(7), thread);
+
+	// Subscribers 1-2, 3, 4, 5 and 6-7 use one message each
+	Block(thread);
+	auto before = GetEnqueued(thread);
+	multicast(0);
+	CHECK(GetEnqueued(thread) - before == 5);
+	releaseThread.SetSignal();
+	Flush(thread);
+	{
+		lock_guard<mutex> lock(orderMtx);
+		CHECK(order == vector<int>{ 1, 2, 3, 4, 5, 6, 7 });
+	}
+
+	// A subscriber with another priority cannot join the fused message, so the
+	// message is queued before it
+	MulticastDelegate<void(int)> priorities;
+	auto high = MakeDelegate(Recorder(9), thread);
+	high.SetPriority(Priority::HIGH);
+	priorities += MakeDelegate(Recorder(8), thread);
+	priorities += high;
+	priorities += MakeDelegate(Recorder(10), thread);
+	Block(thread);
+	before = GetEnqueued(thread);
+	priorities(0);
+	CHECK(GetEnqueued(thread) - before == 3);
+	releaseThread.SetSignal();
+	Flush(thread);
+
+	thread.ExitThread();
+}
+
+// Test thread statistics name the fused subscriber rather than the fused message invoker
+TEST_CASE("MulticastDelegate_IT - FusedTargetType")
+{
+	Thread thread("FusionThread");
+	thread.CreateThread();
+
+	MulticastDelegate<void(int)> multicast;
+	auto slow = MakeDelegate(std::function<void(int)>([](int) { this_thread::sleep_for(milliseconds(20)); }), thread);
+	multicast += slow;
+	multicast += MakeDelegate(std::function<void(int)>([](int) {}), thread);
+	multicast(0);
+	Flush(thread);
+
+	auto stats = thread.GetStats();
+	CHECK(stats.slowestTarget != nullptr);
+	if (stats.slowestTarget)
+		CHECK(strcmp(stats.slowestTarget, typeid(slow).name()) == 0);
+
+	thread.ExitThread();
+}
+
+// Subscriber saving the thread invoking it
+class ThreadRecorder
+{
+public:
+	void Record(int) { threadId = this_thread::get_id(); count++; }
+
+	// Throw on the invoking thread
+	void Throw(int)
+	{
+		Record(0);
+		throw std::runtime_error("ThreadRecorder");
+	}
+
+	std::thread::id threadId;
+	int count = 0;
+};
+
+// Test a parallel broadcast splits the delegates into contiguous chunks, one per thread
+TEST_CASE("MulticastDelegate_IT - ParallelChunks")
+{
+	Thread worker1("ParallelWorker1");
+	Thread worker2("ParallelWorker2");
+	worker1.CreateThread();
+	worker2.CreateThread();
+
+	const int COUNT = 10;
+	ThreadRecorder recorders[COUNT];
+	MulticastDelegate<void(int)> multicast;
+	for (auto& recorder : recorders)
+		multicast += MakeDelegate(&recorder, &ThreadRecorder::Record);
+
+	// Chunks of 4, 3 and 3 delegates. The calling thread runs the first chunk.
+	multicast.BroadcastParallel({ &worker1, &worker2 }, 0);
+	for (int i = 0; i < COUNT; i++)
+	{
+		CHECK(recorders[i].count == 1);
+		auto expected = i < 4 ? this_thread::get_id() : (i < 7 ? worker1.GetThreadId() : worker2.GetThreadId());
+		CHECK(recorders[i].threadId == expected);
+	}
+
+	// No workers; the calling thread invokes every delegate
+	multicast.BroadcastParallel({}, 0);
+	for (auto& recorder : recorders)
+	{
+		CHECK(recorder.count == 2);
+		CHECK(recorder.threadId == this_thread::get_id());
+	}
+
+	worker1.ExitThread();
+	worker2.ExitThread();
+}
+
+// Test an exception thrown on a worker thread is rethrown after all chunks complete
+TEST_CASE("MulticastDelegate_IT - ParallelException")
+{
+	Thread worker("ParallelWorker");
+	worker.CreateThread();
+
+	ThreadRecorder recorders[4];
+	MulticastDelegate<void(int)> multicast;
+	multicast += MakeDelegate(&recorders[0], &ThreadRecorder::Record);
+	multicast += MakeDelegate(&recorders[1], &ThreadRecorder::Record);
+	multicast += MakeDelegate(&recorders[2], &ThreadRecorder::Throw);
+	multicast += MakeDelegate(&recorders[3], &ThreadRecorder::Record);
+
+	// The other chunk completes. As in a synchronous broadcast, the delegates after
+	// the throwing delegate in its chunk are not invoked.
+	CHECK_THROWS_AS(multicast.BroadcastParallel({ &worker }, 0), std::runtime_error);
+	CHECK(recorders[0].count == 1);
+	CHECK(recorders[1].count == 1);
+	CHECK(recorders[2].count == 1);
+	CHECK(recorders[2].threadId == worker.GetThreadId());
+	CHECK(recorders[3].count == 0);
+
+	// The container is usable after the exception
+	multicast -= MakeDelegate(&recorders[2], &ThreadRecorder::Throw);
+	multicast.BroadcastParallel({ &worker }, 0);
+	for (int i = 0; i < 2; i++)
+		CHECK(recorders[i].count == 2);
+	CHECK(recorders[3].count == 1);
+
+	worker.ExitThread();
+}
+
+// Test a chunk discarded by an exited worker thread is run by the calling thread
+TEST_CASE("MulticastDelegate_IT - ParallelDiscardedChunk")
+{
+	Thread worker("ParallelWorker");
+	Thread exited("ParallelExited");
+	worker.CreateThread();
+	exited.CreateThread();
+	exited.ExitThread();
+
+	const int COUNT = 6;
+	ThreadRecorder recorders[COUNT];
+	MulticastDelegate<void(int)> multicast;
+	for (auto& recorder : recorders)
+		multicast += MakeDelegate(&recorder, &ThreadRecorder::Record);
+
+	// Chunks of 2 delegates; the last chunk is discarded by the exited thread
+	multicast.BroadcastParallel({ &worker, &exited }, 0);
+	for (int i = 0; i < COUNT; i++)
+	{
+		CHECK(recorders[i].count == 1);
+		auto expected = (i == 2 || i == 3) ? worker.GetThreadId() : this_thread::get_id();
+		CHECK(recorders[i].threadId == expected);
+	}
+
+	worker.ExitThread();
+}
+
+// Subscriber modifying a thread-safe container from a worker thread
+class SafeModifier
+{
+public:
+	explicit SafeModifier(MulticastDelegateSafe<void(int)>& multicast) : m_multicast(multicast) {}
+
+	// Remove this delegate and insert the counter
+	void Modify(int)
+	{
+		m_multicast -= MakeDelegate(this, &SafeModifier::Modify);
+		m_multicast += MakeDelegate(&counter, &Counter::Inc);
+	}
+
+	Counter counter;
+
+private:
+	MulticastDelegateSafe<void(int)>& m_multicast;
+};
+
+// Test a target function on a worker thread modifying a thread-safe container
+TEST_CASE("MulticastDelegate_IT - ParallelSafeModify")
+{
+	Thread worker("ParallelWorker");
+	worker.CreateThread();
+
+	Counter first;
+	MulticastDelegateSafe<void(int)> multicast;
+	SafeModifier modifier(multicast);
+	multicast += MakeDelegate(&first, &Counter::Inc);
+	multicast += MakeDelegate(&modifier, &SafeModifier::Modify);
+
+	// The modifier runs in the worker chunk while the broadcast is in progress
+	multicast.BroadcastParallel({ &worker }, 1);
+	CHECK(first.count == 1);
+	CHECK(modifier.counter.count == 0);
+	CHECK(multicast.Size() == 2);
+	CHECK(!multicast.Contains(MakeDelegate(&modifier, &SafeModifier::Modify)));
+
+	multicast.BroadcastParallel({ &worker }, 1);
+	CHECK(first.count == 2);
+	CHECK(modifier.counter.count == 1);
+
+	worker.ExitThread();
+}
+
+// Subscriber modifying a copy-on-write container it is invoked by
+class SnapshotModifier
+{
+public:
+	SnapshotModifier(MulticastDelegateSnapshot<void(int)>& multicast, vector<Counter>& counters, Counter& added) :
+		m_multicast(multicast), m_counters(counters), m_added(added) {}
+
+	// Remove this delegate, every odd counter, then insert another delegate
+	void Modify(int)
+	{
+		m_multicast -= MakeDelegate(this, &SnapshotModifier::Modify);
+		for (size_t i = 1; i < m_counters.size(); i += 2)
+			m_multicast -= MakeDelegate(&m_counters[i], &Counter::Inc);
+		m_multicast += MakeDelegate(&m_added, &Counter::Inc);
+	}
+
+private:
+	MulticastDelegateSnapshot<void(int)>& m_multicast;
+	vector<Counter>& m_counters;
+	Counter& m_added;
+};
+
+// Test removing and inserting delegates during a broadcast. The broadcast in
+// progress invokes the array it started with.
+TEST_CASE("MulticastDelegate_IT - SnapshotModifyDuringBroadcast")
+{
+	const int COUNT = 8;
+	vector<Counter> counters(COUNT);
+	Counter added;
+	MulticastDelegateSnapshot<void(int)> multicast;
+	SnapshotModifier modifier(multicast, counters, added);
+
+	multicast += MakeDelegate(&modifier, &SnapshotModifier::Modify);
+	for (auto& counter : counters)
+		multicast += MakeDelegate(&counter, &Counter::Inc);
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT + 1));
+
+	// Removed delegates are still invoked; the inserted delegate is not
+	multicast(1);
+	for (int i = 0; i < COUNT; i++)
+		CHECK(counters[i].count == 1);
+	CHECK(added.count == 0);
+	CHECK(multicast.Size() == static_cast<size_t>(COUNT / 2 + 1));
+
+	// The next broadcast uses the new array
+	multicast(1);
+	for (int i = 0; i < COUNT; i++)
+		CHECK(counters[i].count == (i % 2 == 0 ? 2 : 1));
+	CHECK(added.count == 1);
+
+	// Clearing during a broadcast leaves the remaining delegates invoked
+	auto clear = std::function<void(int)>([&](int) { multicast.Clear(); });
+	multicast += MakeDelegate(clear);
+	multicast(1);
+	CHECK(multicast.Empty());
+	CHECK(counters[0].count == 3);
+	CHECK(added.count == 2);
+}
+
+// Subscriber blocking the broadcasting thread until released
+static void SnapshotBlockCb(int)
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Test a registration change does not wait for a broadcast in progress on another
+// thread, and that broadcast still invokes the removed delegate
+TEST_CASE("MulticastDelegate_IT - SnapshotRemoveWhileBlocked")
+{
+	Counter counter;
+	MulticastDelegateSnapshot<void(int)> multicast;
+	auto counterDelegate = MakeDelegate(&counter, &Counter::Inc);
+	multicast += MakeDelegate(&SnapshotBlockCb);
+	multicast += counterDelegate;
+
+	std::thread broadcaster([&]() { multicast(1); });
+	CHECK(blockedThread.WaitForSignal(500));
+
+	// Changes complete while the broadcast is blocked in a target
+	multicast -= counterDelegate;
+	multicast -= MakeDelegate(&SnapshotBlockCb);
+	CHECK(multicast.Empty());
+
+	releaseThread.SetSignal();
+	broadcaster.join();
+	CHECK(counter.count == 1);
+
+	// The removed delegate is not invoked by a later broadcast
+	multicast(1);
+	CHECK(counter.count == 1);
+}
+
+// Subscriber counting invocations from concurrent broadcasts
+class AtomicCounter
+{
+public:
+	void Inc(int value) { count += value; }
+	atomic<int> count = 0;
+};
+
+// Test concurrent broadcasts while another thread inserts and removes delegates
+TEST_CASE("MulticastDelegate_IT - SnapshotConcurrent")
+{
+	const int BROADCASTERS = 4;
+	const int BROADCASTS = 2000;
+	const int CHURN = 8;
+	AtomicCounter stable;
+	vector<AtomicCounter> churn(CHURN);
+	MulticastDelegateSnapshot<void(int)> multicast;
+	multicast += MakeDelegate(&stable, &AtomicCounter::Inc);
+
+	atomic<bool> done = false;
+	std::thread writer([&]() {
+		while (!done)
+		{
+			for (auto& counter : churn)
+				multicast += MakeDelegate(&counter, &AtomicCounter::Inc);
+			for (auto& counter : churn)
+				multicast -= MakeDelegate(&counter, &AtomicCounter::Inc);
+		}
+	});
+
+	vector<std::thread> broadcasters;
+	for (int i = 0; i < BROADCASTERS; i++)
+	{
+		broadcasters.emplace_back([&]() {
+			for (int j = 0; j < BROADCASTS; j++)
+				multicast(1);
+		});
+	}
+	for (auto& broadcaster : broadcasters)
+		broadcaster.join();
+	done = true;
+	writer.join();
+
+	// The delegate registered throughout is invoked by every broadcast
+	CHECK(stable.count == BROADCASTERS * BROADCASTS);
+	CHECK(multicast.Size() == 1);
+
+	// Each churn delegate is invoked at most once per broadcast
+	for (auto& counter : churn)
+		CHECK(counter.count <= BROADCASTERS * BROADCASTS);
+}
+
+// Dummy function to force linker to keep the code in this file
+void MulticastDelegate_IT_ForceLink() { }
@@ -0,0 +1,105 @@
+// Integration tests for the DelegateMQ SignalSafe connections
+//
+// All tests run within the IntegrationTest thread context.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static int callCount;
+static int otherCount;
+static Connection selfConnection;
+
+// Signal callback handler functions
+static void CountCb(int value) { callCount += value; }
+static void OtherCb(int value) { otherCount += value; }
+
+// Signal callback handler function that disconnects itself
+static void SelfDisconnectCb(int value)
+{
+	callCount += value;
+	selfConnection.Disconnect();
+}
+
+// Test connections disconnected after the signal is destroyed
+TEST_CASE("Signal_IT - DisconnectAfterSignalDestroyed")
+{
+	auto signal = MakeSignal<void(int)>();
+	Connection connection = signal->Connect(MakeDelegate(&CountCb));
+	{
+		ScopedConnection scoped = signal->Connect(MakeDelegate(&OtherCb));
+		CHECK(connection.IsConnected());
+		CHECK(scoped.IsConnected());
+
+		signal.reset();
+
+		// Connections no longer refer to a signal; disconnect is harmless
+		CHECK(!connection.IsConnected());
+		CHECK(!scoped.IsConnected());
+	}
+	connection.Disconnect();
+	connection.Disconnect();
+	CHECK(!connection.IsConnected());
+}
+
+// Test a callback disconnecting its own connection during a broadcast
+TEST_CASE("Signal_IT - SelfDisconnect")
+{
+	callCount = 0;
+	otherCount = 0;
+	auto signal = MakeSignal<void(int)>();
+	selfConnection = signal->Connect(MakeDelegate(&SelfDisconnectCb));
+	ScopedConnection other = signal->Connect(MakeDelegate(&OtherCb));
+	CHECK(signal->Size() == 2);
+
+	(*signal)(1);
+	CHECK(callCount == 1);
+	CHECK(otherCount == 1);
+	CHECK(!selfConnection.IsConnected());
+	CHECK(signal->Size() == 1);
+
+	// Only the remaining subscriber is invoked
+	(*signal)(1);
+	CHECK(callCount == 1);
+	CHECK(otherCount == 2);
+}
+
+// Test disconnecting one of two connections to equal delegates
+TEST_CASE("Signal_IT - DisconnectEqualDelegates")
+{
+	callCount = 0;
+	auto signal = MakeSignal<void(int)>();
+	Connection first = signal->Connect(MakeDelegate(&CountCb));
+	Connection second = signal->Connect(MakeDelegate(&CountCb));
+	CHECK(signal->Size() == 2);
+
+	(*signal)(1);
+	CHECK(callCount == 2);
+
+	// Disconnecting the second connection removes only its own slot
+	second.Disconnect();
+	CHECK(!second.IsConnected());
+	CHECK(first.IsConnected());
+	CHECK(signal->Size() == 1);
+	(*signal)(1);
+	CHECK(callCount == 3);
+
+	// A repeated disconnect does not remove the remaining equal delegate
+	second.Disconnect();
+	CHECK(signal->Size() == 1);
+
+	// A delegate added without a connection is not removed by a connection
+	*signal += MakeDelegate(&CountCb);
+	first.Disconnect();
+	CHECK(signal->Size() == 1);
+	(*signal)(1);
+	CHECK(callCount == 4);
+}
+
+// Dummy function to force linker to keep the code in this file
+void Signal_IT_ForceLink() { }
@@ -0,0 +1,396 @@
+// Integration tests for the DelegateMQ Thread message queue
+//
+// All tests run within the IntegrationTest thread context. Each test creates its
+// own destination thread and blocks it while queuing messages, so the queue
+// contents are known when the thread resumes.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include <cstring>
+#if defined(__linux__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+static vector<int> values;
+static mutex mtx;
+
+// Callback invoked on the destination thread. Saves the value.
+static void ValueCb(int value)
+{
+	lock_guard<mutex> lock(mtx);
+	values.push_back(value);
+}
+
+// Callback invoked on the destination thread. Blocks the thread until released.
+static void BlockCb()
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is
+// blocked, so messages queued afterwards cannot be invoked ahead of BlockCb.
+static void Block(Thread& thread)
+{
+	MakeDelegate(&BlockCb, thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Get a copy of the saved values
+static vector<int> GetValues()
+{
+	lock_guard<mutex> lock(mtx);
+	return values;
+}
+
+// Clear the saved values
+static void ClearValues()
+{
+	lock_guard<mutex> lock(mtx);
+	values.clear();
+}
+
+// Asynchronously invoke ValueCb on a thread with a priority and optional lifetime
+static void Send(Thread& thread, int value, Priority priority, std::optional<Duration> lifetime = std::nullopt)
+{
+	auto delegate = MakeDelegate(&ValueCb, thread);
+	delegate.SetPriority(priority);
+	delegate.SetLifetime(lifetime);
+	delegate(value);
+}
+
+// Wait for a thread to invoke all queued messages. The lowest priority message
+// is invoked last.
+static void Flush(Thread& thread)
+{
+	auto delegate = MakeDelegate(std::function<void()>([]() {}), thread, milliseconds(1000));
+	delegate.SetPriority(Priority::LOW);
+	auto retVal = delegate.AsyncInvoke();
+	CHECK(retVal.has_value());
+}
+
+// Test messages not invoked before their deadline are discarded and counted
+TEST_CASE("Thread_IT - Expired")
+{
+	Thread thread("ExpiredThread");
+	thread.CreateThread();
+	ClearValues();
+
+	// Queue messages behind a blocked target. Lifetimes of 10mS expire before
+	// the thread is released.
+	Block(thread);
+	Send(thread, 1, Priority::NORMAL, milliseconds(10));
+	Send(thread, 2, Priority::NORMAL, milliseconds(2000));
+	Send(thread, 3, Priority::HIGH, milliseconds(10));
+	Send(thread, 4, Priority::LOW);
+	this_thread::sleep_for(milliseconds(50));
+	releaseThread.SetSignal();
+	Flush(thread);
+
+	CHECK(GetValues() == vector<int>{ 2, 4 });
+
+	auto stats = thread.GetStats();
+	CHECK(stats.expired[static_cast<size_t>(Priority::LOW)] == 0);
+	CHECK(stats.expired[static_cast<size_t>(Priority::NORMAL)] == 1);
+	CHECK(stats.expired[static_cast<size_t>(Priority::HIGH)] == 1);
+	CHECK(stats.invoked[static_cast<size_t>(Priority::HIGH)] == 0);
+
+	thread.ExitThread();
+}
+
+// Test queued messages are invoked by priority, then earliest deadline, then
+// first-in first-out
+TEST_CASE("Thread_IT - Order")
+{
+	Thread thread("OrderThread");
+	thread.CreateThread();
+	ClearValues();
+
+	Block(thread);
+	Send(thread, 1, Priority::LOW);
+	Send(thread, 2, Priority::LOW);
+
+	// Many equal messages; a heap alone does not keep them in order
+	for (int i = 10; i < 30; i++)
+		Send(thread, i, Priority::NORMAL);
+
+	// Messages with a deadline precede messages without one, earliest first
+	Send(thread, 30, Priority::NORMAL, milliseconds(2000));
+	Send(thread, 31, Priority::NORMAL, milliseconds(1000));
+	Send(thread, 32, Priority::NORMAL, milliseconds(1000));
+	Send(thread, 40, Priority::HIGH);
+	Send(thread, 41, Priority::HIGH);
+	releaseThread.SetSignal();
+	Flush(thread);
+
+	vector<int> expected{ 40, 41, 31, 32, 30 };
+	for (int i = 10; i < 30; i++)
+		expected.push_back(i);
+	expected.insert(expected.end(), { 1, 2 });
+	CHECK(GetValues() == expected);
+
+	thread.ExitThread();
+}
+
+// Test the watchdog reports a target blocked past the timeout once per stall
+TEST_CASE("Thread_IT - StallDetected")
+{
+	Thread thread("StallThread");
+	thread.CreateThread(milliseconds(100));
+
+	SignalThread stallSignal;
+	ThreadStallInfo stallInfo;
+	int stallCount = 0;
+	auto stallDelegate = MakeDelegate(std::function<void(const ThreadStallInfo&)>(
+		[&](const ThreadStallInfo& info) {
+			lock_guard<mutex> lock(mtx);
+			stallInfo = info;
+			stallCount++;
+			stallSignal.SetSignal();
+		}));
+	thread.StallDetected += stallDelegate;
+
+	// Two messages wait behind the blocked target
+	Block(thread);
+	Send(thread, 1, Priority::NORMAL);
+	Send(thread, 2, Priority::NORMAL);
+	CHECK(stallSignal.WaitForSignal(1000));
+	{
+		lock_guard<mutex> lock(mtx);
+		CHECK(stallInfo.threadName == "StallThread");
+		CHECK(stallInfo.target != nullptr);
+		if (stallInfo.target)
+			CHECK(strcmp(stallInfo.target, typeid(DelegateFreeAsync<void()>).name()) == 0);
+		CHECK(stallInfo.stallTime > milliseconds(100));
+		// The stall is timed from the last heartbeat, which may precede the target
+		CHECK(stallInfo.invokeTime > milliseconds(0));
+		CHECK(stallInfo.invokeTime <= stallInfo.stallTime);
+		// Watchdog heartbeat messages also wait behind the target
+		CHECK(stallInfo.queueSize >= 2);
+	}
+
+	// The same stall is not reported again
+	CHECK(!stallSignal.WaitForSignal(300));
+	releaseThread.SetSignal();
+	Flush(thread);
+	{
+		lock_guard<mutex> lock(mtx);
+		CHECK(stallCount == 1);
+	}
+
+	thread.StallDetected -= stallDelegate;
+	thread.ExitThread();
+}
+
+// Get the histogram bucket index for a sample in microseconds
+static size_t GetBucket(uint64_t us)
+{
+	size_t bucket = 0;
+	while (bucket < ThreadHistogram::BUCKETS - 1 && us >= ThreadHistogram::GetBucketLimitUs(bucket))
+		bucket++;
+	return bucket;
+}
+
+// Get the total of all histogram buckets
+static uint64_t GetBucketTotal(const ThreadHistogram::Snapshot& snapshot)
+{
+	uint64_t total = 0;
+	for (auto count : snapshot.buckets)
+		total += count;
+	return total;
+}
+
+// Test samples are counted in power-of-two buckets at the bucket boundaries
+TEST_CASE("Thread_IT - StatsHistogram")
+{
+	CHECK(ThreadHistogram::GetBucketLimitUs(0) == 1);
+	CHECK(ThreadHistogram::GetBucketLimitUs(1) == 2);
+	CHECK(ThreadHistogram::GetBucketLimitUs(10) == 1024);
+	CHECK(ThreadHistogram::GetBucketLimitUs(ThreadHistogram::BUCKETS - 1) == UINT64_MAX);
+
+	ThreadHistogram histogram;
+	CHECK(histogram.Record(microseconds(0)) == false);
+	CHECK(histogram.Record(microseconds(1)));
+	CHECK(histogram.Record(microseconds(2)));
+	CHECK(histogram.Record(microseconds(3)));
+	CHECK(histogram.Record(microseconds(4)));
+	CHECK(histogram.Record(microseconds(1023)));
+	CHECK(histogram.Record(microseconds(1024)));
+	CHECK(histogram.Record(hours(1)));
+	CHECK(histogram.Record(microseconds(5)) == false);
+
+	// Negative durations are counted as zero
+	CHECK(histogram.Record(microseconds(-5)) == false);
+
+	auto snapshot = histogram.GetSnapshot();
+	CHECK(snapshot.count == 10);
+	CHECK(snapshot.buckets[0] == 2);
+	CHECK(snapshot.buckets[1] == 1);
+	CHECK(snapshot.buckets[2] == 2);
+	CHECK(snapshot.buckets[3] == 2);
+	CHECK(snapshot.buckets[10] == 1);
+	CHECK(snapshot.buckets[11] == 1);
+	CHECK(snapshot.buckets[ThreadHistogram::BUCKETS - 1] == 1);
+	CHECK(GetBucketTotal(snapshot) == snapshot.count);
+	CHECK(snapshot.maxUs == 3600000000ULL);
+
+	// The percentile is the upper limit of the bucket containing it; the last
+	// bucket reports the maximum
+	CHECK(snapshot.PercentileUs(0.0) == 1);
+	CHECK(snapshot.PercentileUs(50.0) == 8);
+	CHECK(snapshot.PercentileUs(100.0) == snapshot.maxUs);
+
+	histogram.Reset();
+	snapshot = histogram.GetSnapshot();
+	CHECK(snapshot.count == 0);
+	CHECK(GetBucketTotal(snapshot) == 0);
+	CHECK(snapshot.PercentileUs(50.0) == 0);
+	CHECK(snapshot.MeanUs() == 0.0);
+}
+
+// Test the queue depth follows messages queued behind a blocked target
+TEST_CASE("Thread_IT - StatsQueueDepth")
+{
+	Thread thread("StatsThread");
+	thread.CreateThread();
+	ClearValues();
+
+	Block(thread);
+	thread.ResetStats();
+	for (int i = 0; i < 5; i++)
+		Send(thread, i, Priority::NORMAL);
+
+	auto stats = thread.GetStats();
+	CHECK(stats.queueDepth == 5);
+	CHECK(stats.maxQueueDepth == 5);
+	CHECK(thread.GetQueueSize() == 5);
+	CHECK(stats.enqueued[static_cast<size_t>(Priority::NORMAL)] == 5);
+
+	this_thread::sleep_for(milliseconds(20));
+	releaseThread.SetSignal();
+	Flush(thread);
+
+	stats = thread.GetStats();
+	CHECK(stats.queueDepth == 0);
+	CHECK(thread.GetQueueSize() == 0);
+	CHECK(stats.maxQueueDepth >= 5);
+	CHECK(stats.invoked[static_cast<size_t>(Priority::NORMAL)] >= 5);
+
+	// Messages waited behind the blocked target; every sample is in a bucket and
+	// the longest wait lies in the bucket for the maximum
+	CHECK(stats.queueLatency.count >= 5);
+	CHECK(stats.queueLatency.maxUs >= 20000);
+	CHECK(GetBucketTotal(stats.queueLatency) == stats.queueLatency.count);
+	CHECK(stats.queueLatency.buckets[GetBucket(stats.queueLatency.maxUs)] >= 1);
+
+	// Reset keeps the current depth as the new maximum. The flush target returns
+	// its value before the worker thread records the invoke time.
+	this_thread::sleep_for(milliseconds(10));
+	thread.ResetStats();
+	stats = thread.GetStats();
+	CHECK(stats.maxQueueDepth == 0);
+	CHECK(stats.queueLatency.count == 0);
+	CHECK(stats.slowestTarget == nullptr);
+
+	thread.ExitThread();
+}
+
+// Callback invoked on the destination thread. Executes for a known time.
+static void SlowCb()
+{
+	this_thread::sleep_for(milliseconds(30));
+}
+
+// Test the invoke time histogram and the slowest target type
+TEST_CASE("Thread_IT - StatsSlowestTarget")
+{
+	Thread thread("StatsThread");
+	thread.CreateThread();
+	ClearValues();
+	Flush(thread);
+	this_thread::sleep_for(milliseconds(10));
+	thread.ResetStats();
+
+	// Fast targets, then one slow target, then fast targets again
+	Send(thread, 1, Priority::NORMAL);
+	MakeDelegate(&SlowCb, thread)();
+	Send(thread, 2, Priority::NORMAL);
+	Flush(thread);
+	this_thread::sleep_for(milliseconds(10));
+
+	auto stats = thread.GetStats();
+	CHECK(stats.invokeTime.count == 4);
+	CHECK(stats.invokeTime.maxUs >= 30000);
+	CHECK(stats.invokeTime.totalUs >= 30000);
+	CHECK(GetBucketTotal(stats.invokeTime) == stats.invokeTime.count);
+	CHECK(stats.invokeTime.buckets[GetBucket(stats.invokeTime.maxUs)] == 1);
+	CHECK(stats.invokeTime.PercentileUs(100.0) >= 30000);
+
+	// The slow target is reported even though faster targets ran afterwards
+	CHECK(stats.slowestTarget != nullptr);
+	if (stats.slowestTarget)
+		CHECK(strcmp(stats.slowestTarget, typeid(DelegateFreeAsync<void()>).name()) == 0);
+
+	thread.ExitThread();
+}
+
+#if defined(__linux__)
+// Test WatchdogAction::ABORT terminates the process after a stall. The fault
+// handler aborts, so the stall runs in a child process.
+TEST_CASE("Thread_IT - WatchdogAbort")
+{
+	// Stop the timer thread so its lock is free in the child. Only the forking
+	// thread exists in the child, which services the timers itself.
+	Timer::StopTimerThread();
+	pid_t pid = fork();
+	if (pid == 0)
+	{
+		// Terminate without the test framework crash report
+		signal(SIGABRT, SIG_DFL);
+		Thread thread("AbortThread");
+		thread.CreateThread(milliseconds(100));
+		thread.SetWatchdogAction(WatchdogAction::ABORT);
+		MakeDelegate(std::function<void()>([]() { this_thread::sleep_for(milliseconds(2000)); }), thread)();
+		for (int i = 0; i < 200; i++)
+		{
+			this_thread::sleep_for(milliseconds(10));
+			Timer::ProcessTimers();
+		}
+		_exit(0);
+	}
+	Timer::StartTimerThread();
+	CHECK(pid > 0);
+	if (pid <= 0)
+		return;
+
+	// Wait for the child to terminate
+	int status = 0;
+	pid_t result = 0;
+	for (int i = 0; i < 500 && result == 0; i++)
+	{
+		this_thread::sleep_for(milliseconds(10));
+		result = waitpid(pid, &status, WNOHANG);
+	}
+	if (result == 0)
+	{
+		kill(pid, SIGKILL);
+		waitpid(pid, &status, 0);
+	}
+	CHECK(result == pid);
+	CHECK(WIFSIGNALED(status));
+	CHECK(WTERMSIG(status) == SIGABRT);
+}
+#endif
+
+// Dummy function to force linker to keep the code in this file
+void Thread_IT_ForceLink() { }
@@ -0,0 +1,296 @@
+// Integration tests for the DelegateMQ Timer class
+//
+// All tests run within the IntegrationTest thread context. Tests that call
+// Timer::ProcessTimers() directly first stop the timer thread started by main()
+// so that only the test services the timers, then restart it on completion.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include <ctime>
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Call Timer::ProcessTimers() every millisecond until done() returns true or
+// the timeout expires.
+// @return Returns true if done() returned true, false if timed out.
+template <class F>
+static bool ProcessTimersUntil(F done, milliseconds timeout)
+{
+	auto end = Timer::GetNow() + timeout;
+	while (!done())
+	{
+		if (Timer::GetNow() > end)
+			return false;
+		this_thread::sleep_for(milliseconds(1));
+		Timer::ProcessTimers();
+	}
+	return true;
+}
+
+// Test Timer::GetNextExpiration() with an empty wheel, a wheel slot and the due list
+TEST_CASE("Timer_IT - GetNextExpiration")
+{
+	Timer::StopTimerThread();
+
+	// No timer is running
+	CHECK(!Timer::GetNextExpiration().has_value());
+
+	// A timer past the level 1 range waits in a cascading slot at or before its expiration
+	Timer timer;
+	auto start = Timer::GetNow();
+	timer.Start(milliseconds(5000), true);
+	auto next = Timer::GetNextExpiration();
+	CHECK(next.has_value());
+	if (next.has_value())
+	{
+		CHECK(next.value() >= start);
+		CHECK(next.value() <= start + milliseconds(5000));
+	}
+
+	// A stopped timer leaves the wheel empty
+	timer.Stop();
+	CHECK(!Timer::GetNextExpiration().has_value());
+
+	// A periodic timer that falls behind is rescheduled onto the due list
+	int expired = 0;
+	Timer periodic;
+	*periodic.Expired += MakeDelegate(std::function<void()>([&expired]() { expired++; }));
+	periodic.Start(milliseconds(1));
+	this_thread::sleep_for(milliseconds(10));
+	Timer::ProcessTimers();
+	CHECK(expired == 1);
+
+	// The due list expires now
+	next = Timer::GetNextExpiration();
+	CHECK(next.has_value());
+	if (next.has_value())
+		CHECK(next.value() <= Timer::GetNow());
+
+	periodic.Stop();
+	CHECK(!Timer::GetNextExpiration().has_value());
+
+	Timer::StartTimerThread();
+}
+
+// Test one-shot and periodic timers expire at most once per ProcessTimers() call
+TEST_CASE("Timer_IT - OnceAndPeriodic")
+{
+	Timer::StopTimerThread();
+
+	int onceExpired = 0;
+	int periodicExpired = 0;
+	Timer once;
+	Timer periodic;
+	*once.Expired += MakeDelegate(std::function<void()>([&onceExpired]() { onceExpired++; }));
+	*periodic.Expired += MakeDelegate(std::function<void()>([&periodicExpired]() { periodicExpired++; }));
+	once.Start(milliseconds(1), true);
+	periodic.Start(milliseconds(1));
+
+	// Each call is many periods late, yet the periodic timer expires only once
+	for (int i = 1; i <= 5; i++)
+	{
+		this_thread::sleep_for(milliseconds(20));
+		Timer::ProcessTimers();
+		CHECK(onceExpired == 1);
+		CHECK(periodicExpired == i);
+	}
+
+	CHECK(!once.Enabled());
+	CHECK(periodic.Enabled());
+	periodic.Stop();
+
+	Timer::StartTimerThread();
+}
+
+// Test a timer callback stopping, restarting and deleting other expiring timers
+TEST_CASE("Timer_IT - ModifyTimersInCallback")
+{
+	Timer::StopTimerThread();
+
+	const int TIMERS = 4;
+	unique_ptr<Timer> timers[TIMERS];
+	int expired[TIMERS] = {};
+	int first = -1;
+
+	for (int i = 0; i < TIMERS; i++)
+	{
+		timers[i] = make_unique<Timer>();
+		*timers[i]->Expired += MakeDelegate(std::function<void()>([&, i]() {
+			expired[i]++;
+			if (first >= 0)
+				return;
+
+			// The first timer to expire stops, restarts and deletes the others.
+			// All are due within the same ProcessTimers() call.
+			first = i;
+			timers[(i + 1) % TIMERS]->Stop();
+			timers[(i + 2) % TIMERS]->Start(milliseconds(20), true);
+			timers[(i + 3) % TIMERS].reset();
+		}));
+	}
+	for (int i = 0; i < TIMERS; i++)
+		timers[i]->Start(milliseconds(5), true);
+
+	this_thread::sleep_for(milliseconds(10));
+	Timer::ProcessTimers();
+
+	CHECK(first >= 0);
+	if (first >= 0)
+	{
+		int stopped = (first + 1) % TIMERS;
+		int restarted = (first + 2) % TIMERS;
+		int deleted = (first + 3) % TIMERS;
+
+		CHECK(expired[first] == 1);
+		CHECK(expired[stopped] == 0);
+		CHECK(expired[restarted] == 0);
+		CHECK(expired[deleted] == 0);
+		CHECK(timers[deleted] == nullptr);
+
+		// Only the restarted timer expires later
+		CHECK(ProcessTimersUntil([&]() { return expired[restarted] == 1; }, milliseconds(500)));
+		CHECK(expired[first] == 1);
+		CHECK(expired[stopped] == 0);
+		CHECK(!Timer::GetNextExpiration().has_value());
+	}
+
+	Timer::StartTimerThread();
+}
+
+// Test a timer past the level 1 boundary (4096mS) cascades down the wheel and
+// expires once, not early
+TEST_CASE("Timer_IT - Cascade")
+{
+	Timer::StopTimerThread();
+
+	const milliseconds TIMEOUT(4200);
+	int expired = 0;
+	TimePoint expireTime;
+	Timer timer;
+	*timer.Expired += MakeDelegate(std::function<void()>([&]() {
+		expired++;
+		expireTime = Timer::GetNow();
+	}));
+
+	auto start = Timer::GetNow();
+	timer.Start(TIMEOUT, true);
+
+	CHECK(ProcessTimersUntil([&]() { return expired > 0; }, TIMEOUT + milliseconds(1000)));
+	CHECK(expired == 1);
+	CHECK(expireTime >= start + TIMEOUT);
+	CHECK(expireTime <= start + TIMEOUT + milliseconds(100));
+
+	// Nothing remains in the wheel
+	Timer::ProcessTimers();
+	CHECK(expired == 1);
+	CHECK(!Timer::GetNextExpiration().has_value());
+
+	Timer::StartTimerThread();
+}
+
+#if defined(DMQ_THREAD_STDLIB)
+// Test the timer thread wakes early when a sooner timer is started
+TEST_CASE("Timer_IT - ThreadWakeup")
+{
+	Timer::StartTimerThread();
+
+	SignalThread signal;
+	Timer timer;
+	*timer.Expired += MakeDelegate(std::function<void()>([&signal]() { signal.SetSignal(); }));
+
+	// Idle thread sleeps without a deadline until a timer is started. Timer
+	// resolution is 1mS, so a 20mS timer may expire after 19mS.
+	auto start = steady_clock::now();
+	timer.Start(milliseconds(20), true);
+	CHECK(signal.WaitForSignal(500));
+	auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+	CHECK(elapsed >= milliseconds(19));
+	CHECK(elapsed < milliseconds(200));
+
+	// Thread sleeps until the long timer cascade, at least 55 seconds away
+	Timer longTimer;
+	longTimer.Start(milliseconds(60000), true);
+	this_thread::sleep_for(milliseconds(10));
+
+	start = steady_clock::now();
+	timer.Start(milliseconds(20), true);
+	CHECK(signal.WaitForSignal(500));
+	elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+	CHECK(elapsed >= milliseconds(19));
+	CHECK(elapsed < milliseconds(200));
+
+	longTimer.Stop();
+}
+
+// Test an idle timer thread sleeps instead of polling
+TEST_CASE("Timer_IT - ThreadIdle")
+{
+	Timer::StartTimerThread();
+	CHECK(!Timer::GetNextExpiration().has_value());
+
+	// Process CPU time over 500mS with no running timers. A thread polling
+	// every 50uS uses tens of milliseconds.
+	clock_t start = clock();
+	this_thread::sleep_for(milliseconds(500));
+	double cpuMs = 1000.0 * (clock() - start) / CLOCKS_PER_SEC;
+	CHECK(cpuMs < 10.0);
+}
+
+// Test StopTimerThread() called by a timer callback on the timer thread
+TEST_CASE("Timer_IT - StopThreadInCallback")
+{
+	Timer::StartTimerThread();
+
+	SignalThread signal;
+	Timer stopper;
+	*stopper.Expired += MakeDelegate(std::function<void()>([&signal]() {
+		// Cannot join itself; the thread is detached and exits after the callback
+		Timer::StopTimerThread();
+		signal.SetSignal();
+	}));
+	stopper.Start(milliseconds(10), true);
+	CHECK(signal.WaitForSignal(500));
+
+	// No thread processes timers
+	Timer timer;
+	*timer.Expired += MakeDelegate(std::function<void()>([&signal]() { signal.SetSignal(); }));
+	timer.Start(milliseconds(10), true);
+	CHECK(!signal.WaitForSignal(100));
+
+	// A new thread expires the waiting timer
+	Timer::StartTimerThread();
+	CHECK(signal.WaitForSignal(500));
+}
+
+// Test starting and stopping the timer thread repeatedly
+TEST_CASE("Timer_IT - StartStopThread")
+{
+	SignalThread signal;
+	Timer timer;
+	*timer.Expired += MakeDelegate(std::function<void()>([&signal]() { signal.SetSignal(); }));
+
+	for (int i = 0; i < 3; i++)
+	{
+		// A stopped thread does not expire timers
+		Timer::StopTimerThread();
+		timer.Start(milliseconds(10), true);
+		CHECK(!signal.WaitForSignal(100));
+
+		// Starting twice is harmless
+		Timer::StartTimerThread();
+		Timer::StartTimerThread();
+		CHECK(signal.WaitForSignal(500));
+	}
+
+	// Stopping twice is harmless
+	Timer::StopTimerThread();
+	Timer::StopTimerThread();
+	Timer::StartTimerThread();
+}
+#endif
+
+// Dummy function to force linker to keep the code in this file
+void Timer_IT_ForceLink() { }
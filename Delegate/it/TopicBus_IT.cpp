@@ -0,0 +1,209 @@
+// Integration tests for the DelegateMQ TopicBus
+//
+// All tests run within the IntegrationTest thread context. Each test creates its
+// own bus, and a destination thread for asynchronous subscribers.
+
+#include "DelegateMQ.h"
+#include "SignalThread.h"
+#include "IT_Util.h"		// Include this last
+
+using namespace std;
+using namespace std::chrono;
+using namespace dmq;
+
+// Local integration test variables
+static SignalThread blockedThread;
+static SignalThread releaseThread;
+static vector<int> values;
+static mutex mtx;
+
+// Test topics
+using ValueTopic = Topic<1, void(int)>;
+using OtherTopic = Topic<2, void(int)>;
+using LastTopic = Topic<TopicBus::MAX_TOPICS - 1, void()>;
+
+// Subscriber saving the value
+static void SaveValue(int value)
+{
+	lock_guard<mutex> lock(mtx);
+	values.push_back(value);
+}
+
+// Get a copy of the saved values
+static vector<int> GetValues()
+{
+	lock_guard<mutex> lock(mtx);
+	return values;
+}
+
+// Clear the saved values
+static void ClearValues()
+{
+	lock_guard<mutex> lock(mtx);
+	values.clear();
+}
+
+// Callback invoked on the destination thread. Blocks the thread until released.
+static void BlockCb()
+{
+	blockedThread.SetSignal();
+	releaseThread.WaitForSignal(2000);
+}
+
+// Block a thread until releaseThread is signaled. Returns once the thread is blocked.
+static void Block(Thread& thread)
+{
+	MakeDelegate(&BlockCb, thread)();
+	CHECK(blockedThread.WaitForSignal(500));
+}
+
+// Wait for a thread to invoke all queued messages
+static void Flush(Thread& thread)
+{
+	auto retVal = MakeDelegate(std::function<void()>([]() {}), thread, milliseconds(1000)).AsyncInvoke();
+	CHECK(retVal.has_value());
+}
+
+// Test a subscriber without a thread is invoked by the publishing thread before
+// Publish() returns
+TEST_CASE("TopicBus_IT - SyncSubscriber")
+{
+	TopicBus bus;
+	ClearValues();
+
+	std::thread::id subscriberThread;
+	ScopedConnection conn = bus.Subscribe<ValueTopic>([&](int value) {
+		subscriberThread = this_thread::get_id();
+		SaveValue(value);
+	});
+	CHECK(conn.IsConnected());
+
+	bus.Publish<ValueTopic>(1);
+	CHECK(GetValues() == vector<int>{ 1 });
+	CHECK(subscriberThread == this_thread::get_id());
+
+	auto stats = bus.GetStats<ValueTopic>();
+	CHECK(stats.published == 1);
+	CHECK(stats.delivered == 1);
+	CHECK(stats.maxLatency >= nanoseconds(0));
+	CHECK(stats.AverageLatency() == stats.totalLatency);
+
+	// A publish to another topic is not delivered
+	bus.Publish<OtherTopic>(2);
+	CHECK(GetValues() == vector<int>{ 1 });
+	CHECK(bus.GetStats<OtherTopic>().published == 1);
+	CHECK(bus.GetStats<OtherTopic>().delivered == 0);
+}
+
+// Test a subscriber with a thread is invoked asynchronously on that thread
+TEST_CASE("TopicBus_IT - AsyncSubscriber")
+{
+	Thread thread("TopicThread");
+	thread.CreateThread();
+	TopicBus bus;
+	ClearValues();
+
+	std::thread::id subscriberThread;
+	ScopedConnection conn = bus.Subscribe<ValueTopic>([&](int value) {
+		subscriberThread = this_thread::get_id();
+		SaveValue(value);
+	}, thread);
+
+	// Nothing is delivered while the thread is blocked
+	Block(thread);
+	bus.Publish<ValueTopic>(1);
+	bus.Publish<ValueTopic>(2);
+	CHECK(GetValues().empty());
+	auto stats = bus.GetStats<ValueTopic>();
+	CHECK(stats.published == 2);
+	CHECK(stats.delivered == 0);
+
+	// Latency includes the time queued behind the blocked target
+	this_thread::sleep_for(milliseconds(20));
+	releaseThread.SetSignal();
+	Flush(thread);
+	CHECK(GetValues() == vector<int>{ 1, 2 });
+	CHECK(subscriberThread == thread.GetThreadId());
+
+	stats = bus.GetStats<ValueTopic>();
+	CHECK(stats.delivered == 2);
+	CHECK(stats.maxLatency >= milliseconds(20));
+	CHECK(stats.AverageLatency() <= stats.maxLatency);
+
+	thread.ExitThread();
+}
+
+// Test the subscriber count follows connections, including a ScopedConnection
+// leaving scope
+TEST_CASE("TopicBus_IT - SubscriberCount")
+{
+	TopicBus bus;
+	ClearValues();
+	CHECK(bus.GetSubscriberCount<ValueTopic>() == 0);
+
+	Connection conn = bus.Subscribe<ValueTopic>(&SaveValue);
+	CHECK(bus.GetSubscriberCount<ValueTopic>() == 1);
+	{
+		ScopedConnection scoped = bus.Subscribe<ValueTopic>([](int value) { SaveValue(-value); });
+		CHECK(bus.GetSubscriberCount<ValueTopic>() == 2);
+		bus.Publish<ValueTopic>(1);
+		CHECK(GetValues() == vector<int>{ 1, -1 });
+	}
+
+	// The scoped subscriber is removed and no longer invoked
+	CHECK(bus.GetSubscriberCount<ValueTopic>() == 1);
+	bus.Publish<ValueTopic>(2);
+	CHECK(GetValues() == vector<int>{ 1, -1, 2 });
+
+	conn.Disconnect();
+	CHECK(bus.GetSubscriberCount<ValueTopic>() == 0);
+	CHECK(bus.GetSubscriberCount<OtherTopic>() == 0);
+}
+
+// Test the published and delivered counts with sync and async subscribers
+TEST_CASE("TopicBus_IT - Stats")
+{
+	Thread thread("TopicThread");
+	thread.CreateThread();
+	TopicBus bus;
+	ClearValues();
+
+	ScopedConnection syncConn = bus.Subscribe<ValueTopic>(&SaveValue);
+	ScopedConnection asyncConn = bus.Subscribe<ValueTopic>([](int value) { SaveValue(value + 10); }, thread);
+
+	const int PUBLISHES = 3;
+	for (int i = 0; i < PUBLISHES; i++)
+		bus.Publish<ValueTopic>(i);
+	Flush(thread);
+	CHECK(GetValues().size() == PUBLISHES * 2);
+
+	// Each publish is delivered to each subscriber
+	auto stats = bus.GetStats<ValueTopic>();
+	CHECK(stats.published == PUBLISHES);
+	CHECK(stats.delivered == PUBLISHES * 2);
+	CHECK(stats.firstPublish <= stats.lastPublish);
+	CHECK(stats.PublishRate() >= 0.0);
+
+	// Statistics by identifier match statistics by topic type
+	auto byId = bus.GetStats(ValueTopic::ID);
+	CHECK(byId.published == stats.published);
+	CHECK(byId.delivered == stats.delivered);
+
+	// A single publish has no rate; an unused topic is all zero
+	bus.Publish<LastTopic>();
+	CHECK(bus.GetStats<LastTopic>().published == 1);
+	CHECK(bus.GetStats<LastTopic>().PublishRate() == 0.0);
+	CHECK(bus.GetStats<OtherTopic>().published == 0);
+	CHECK(bus.GetStats<OtherTopic>().AverageLatency() == nanoseconds(0));
+
+	// Identifiers out of range return all zero
+	auto outOfRange = bus.GetStats(static_cast<TopicId>(TopicBus::MAX_TOPICS));
+	CHECK(outOfRange.published == 0);
+	CHECK(outOfRange.delivered == 0);
+	CHECK(bus.GetStats(static_cast<TopicId>(UINT16_MAX)).published == 0);
+
+	thread.ExitThread();
+}
+
+// Dummy function to force linker to keep the code in this file
+void TopicBus_IT_ForceLink() { }
@@ -55,11 +55,14 @@
 /// See README.md, DETAILS.md, EXAMPLES.md, and source code Doxygen comments for more information.
 
 #include "delegate/DelegateOpt.h"
+#include "delegate/DelegateValue.h"
 #include "delegate/MulticastDelegateSafe.h"
+#include "delegate/MulticastDelegateSnapshot.h"
 #include "delegate/UnicastDelegateSafe.h"
 #include "delegate/SignalSafe.h"
 #include "delegate/DelegateAsync.h"
 #include "delegate/DelegateAsyncWait.h"
+#include "delegate/DelegateAwait.h"
 #include "delegate/DelegateRemote.h"
 
 #if defined(DMQ_THREAD_STDLIB)
@@ -118,5 +121,6 @@
 #include "predef/util/Timer.h"
 #include "predef/util/TransportMonitor.h"
 #include "predef/util/AsyncInvoke.h"
+#include "predef/util/TopicBus.h"
 
 #endif
@@ -0,0 +1,259 @@
+#ifndef _BROADCAST_FUSION_H
+#define _BROADCAST_FUSION_H
+
+/// @file
+/// @brief Deliver one multicast broadcast to all asynchronous delegates bound to the
+/// same destination thread using a single message.
+///
+/// @details A broadcast to N `DelegateAsync` subscribers normally copies the arguments
+/// N times and queues N messages. `BroadcastFusion` groups the subscribers by destination
+/// thread and priority, copies the arguments once per group into a `DelegateFusedMsg`
+/// and queues one message per group. The destination thread invokes each subscriber
+/// in subscription order using the shared argument copy.
+///
+/// Messages are queued in subscription order. The collected messages are dispatched
+/// before a subscriber that cannot join a group is invoked, and a group is dispatched
+/// before a subscriber on the same thread with another priority is added.
+///
+/// A call is fused only if every subscriber can safely read the same argument copy: by
+/// value, `const T&` and `const T*` arguments. A by value argument is copied to each
+/// target; move semantics do not apply. Non-const reference, non-const pointer and
+/// rvalue reference signatures are always dispatched individually. Conflating, expiring
+/// and same thread inline delegates are also dispatched individually.
+
+#include "Delegate.h"
+#include "IThread.h"
+#include "arg_storage.h"
+#include <exception>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+
+namespace dmq {
+
+namespace trait
+{
+    // Helper trait to check if one argument copy may be shared by several targets
+    template <typename T>
+    struct is_fusable_arg : std::is_copy_constructible<T> {};
+
+    template <typename T>
+    struct is_fusable_arg<T&> : std::false_type {};
+
+    template <typename T>
+    struct is_fusable_arg<const T&> : std::true_type {};
+
+    template <typename T>
+    struct is_fusable_arg<T&&> : std::false_type {};
+
+    template <typename T>
+    struct is_fusable_arg<T*> : std::false_type {};
+
+    template <typename T>
+    struct is_fusable_arg<const T*> : std::negation<std::is_pointer<T>> {};
+
+    // The argument type stored by a fused message. A by value argument is stored
+    // once as a const copy.
+    template <typename T>
+    using fused_arg_t = std::conditional_t<std::is_reference_v<T> || std::is_pointer_v<T>, T, const T&>;
+}
+
+/// @brief Message invoking a group of asynchronous delegates bound to the same destination
+/// thread. Holds one copy of the function arguments and a shared invoker per target.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+template <class RetType, class... Args>
+class DelegateFusedMsg : public DelegateMsg
+{
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+
+    /// Maximum targets per message. A larger group uses several messages.
+    static constexpr std::size_t MAX_TARGETS = 16;
+
+    /// Constructor
+    /// @param[in] invoker - the fused message invoker instance
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateFusedMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, trait::fused_arg_t<Args>... args) :
+        DelegateMsg(std::move(invoker), priority, TypeIdOf<DelegateFusedMsg>()),
+        m_args(args...) {}
+
+    DelegateFusedMsg(const DelegateFusedMsg&) = delete;
+    DelegateFusedMsg& operator=(const DelegateFusedMsg&) = delete;
+
+    virtual ~DelegateFusedMsg() = default;
+
+    /// Append a target.
+    /// @param[in] target - the target shared invoker. See `Delegate::GetFusionInvoker()`.
+    void AddTarget(std::shared_ptr<DelegateType> target) { m_targets[m_count++] = std::move(target); }
+
+    /// @return `true` if no further target can be added.
+    bool Full() const noexcept { return m_count == MAX_TARGETS; }
+
+    /// Get the type of the first target. See `DelegateMsg::GetTargetType()`.
+    /// @return The first target invoker type, so diagnostics name a subscriber
+    /// rather than the fused message invoker.
+    virtual const std::type_info& GetTargetType() const override {
+        return m_count > 0 ? typeid(*m_targets[0]) : DelegateMsg::GetTargetType();
+    }
+
+    /// Invoke each target in order using the stored arguments. A throwing target
+    /// does not prevent the remaining targets from being invoked.
+    /// @throws Rethrows the first exception thrown by a target function.
+    void InvokeTargets() {
+        std::exception_ptr error;
+        for (std::size_t i = 0; i < m_count; i++) {
+            try {
+                DelegateType& target = *m_targets[i];
+                std::apply([&target](auto&... arg) { target.InvokeTarget(arg.get()...); }, m_args);
+            }
+            catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+private:
+    /// A tuple with one copy of each argument shared by all targets
+    std::tuple<arg_storage<trait::fused_arg_t<Args>>...> m_args;
+
+    /// The target shared invokers
+    std::shared_ptr<DelegateType> m_targets[MAX_TARGETS];
+    std::size_t m_count = 0;
+};
+
+/// @brief Invoker shared by all fused messages of one function signature
+template <class RetType, class... Args>
+class DelegateFusedInvoker : public IThreadInvoker
+{
+public:
+    /// Get the shared instance using the "Immortal" Pattern. Fused messages may
+    /// be destroyed after static destructors run.
+    static const std::shared_ptr<IThreadInvoker>& GetInstance() {
+        static auto* instance = new std::shared_ptr<IThreadInvoker>(new DelegateFusedInvoker());
+        return *instance;
+    }
+
+    /// Invoke the message targets. Called by the destination thread.
+    virtual bool Invoke(DelegateMsg& msg) override {
+        auto fusedMsg = MsgCast<DelegateFusedMsg<RetType, Args...>>(msg);
+        if (fusedMsg == nullptr)
+            return false;
+        fusedMsg->InvokeTargets();
+        return true;
+    }
+};
+
+/// @brief Collects the fusable delegates of one broadcast by destination thread and
+/// priority. Lives on the broadcasting thread stack.
+template <class RetType, class... Args>
+class BroadcastFusion
+{
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+    using MsgType = DelegateFusedMsg<RetType, Args...>;
+
+    /// `true` if the function signature supports fusion
+    static constexpr bool ENABLED = std::conjunction_v<trait::is_fusable_arg<Args>...>;
+
+    /// Maximum destination groups collected at once. A further group dispatches
+    /// the collected messages first.
+    static constexpr std::size_t MAX_GROUPS = 8;
+
+    /// Constructor
+    /// @param[in] args - the broadcast arguments. Must outlive this object.
+    explicit BroadcastFusion(trait::fused_arg_t<Args>... args) : m_args(args...) {}
+
+    /// Destructor. Dispatches messages collected before a target function threw.
+    ~BroadcastFusion() {
+        try {
+            Dispatch();
+        }
+        catch (...) {
+            // The broadcast is already propagating an exception
+        }
+    }
+
+    BroadcastFusion(const BroadcastFusion&) = delete;
+    BroadcastFusion& operator=(const BroadcastFusion&) = delete;
+
+    /// Add a delegate to the group for its destination thread.
+    /// @param[in] delegate - the delegate to invoke.
+    /// @return `false` if the delegate is not fusable and must be invoked individually.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    bool Add(const DelegateType& delegate) {
+        Priority priority;
+        IThread* thread = delegate.GetFusionThread(priority);
+        if (!thread) {
+            // Queue the collected messages before the delegate is invoked
+            Dispatch();
+            return false;
+        }
+
+        Group* group = nullptr;
+        for (std::size_t i = 0; i < m_groupCount; i++) {
+            if (m_groups[i].thread != thread)
+                continue;
+            if (m_groups[i].priority == priority)
+                group = &m_groups[i];
+            else if (m_groups[i].msg)
+                // Earlier delegates on this thread are queued first
+                thread->DispatchDelegate(std::move(m_groups[i].msg));
+        }
+        if (!group) {
+            if (m_groupCount == MAX_GROUPS)
+                Dispatch();
+            group = &m_groups[m_groupCount++];
+            group->thread = thread;
+            group->priority = priority;
+        }
+
+        if (!group->msg) {
+            group->msg = std::apply([priority](auto&... arg) {
+                return MakeMsg<MsgType>(DelegateFusedInvoker<RetType, Args...>::GetInstance(), priority, arg...);
+            }, m_args);
+            if (!group->msg)
+                BAD_ALLOC();
+        }
+
+        group->msg->AddTarget(delegate.GetFusionInvoker());
+
+        // Dispatch a full message now; the next delegate starts another
+        if (group->msg->Full())
+            thread->DispatchDelegate(std::move(group->msg));
+        return true;
+    }
+
+    /// Dispatch one message per destination group and start new groups
+    void Dispatch() {
+        std::size_t count = m_groupCount;
+        m_groupCount = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            if (m_groups[i].msg)
+                m_groups[i].thread->DispatchDelegate(std::move(m_groups[i].msg));
+        }
+    }
+
+private:
+    /// Delegates sharing one destination thread and priority
+    struct Group {
+        IThread* thread = nullptr;
+        Priority priority = Priority::NORMAL;
+        MsgPtr<MsgType> msg;
+    };
+
+    /// The broadcast arguments
+    std::tuple<trait::fused_arg_t<Args>...> m_args;
+
+    Group m_groups[MAX_GROUPS];
+    std::size_t m_groupCount = 0;
+};
+
+}
+
+#endif
@@ -19,13 +19,20 @@
 /// * `std::function` compares the function signature type, not the underlying object instance.
 /// See `DelegateFunction<>` class for more info.
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <new>
 #include "DelegateOpt.h"
 
 /// The delegate library namespace
 namespace dmq {
 
+class IThread;
+enum class Priority;
+
 /// @brief Non-template base class for all delegates.
 class DelegateBase {
 public:
@@ -54,6 +61,12 @@ public:
     /// @return `true` if the objects are equal, `false` otherwise.
     virtual bool Equal(const DelegateBase& other) const = 0;
 
+    /// @brief Get a hash of the bound target identity.
+    /// @details Equal delegates return equal hash values. Used by delegate containers 
+    /// to index delegates for fast lookup.
+    /// @return The hash value. The default returns 0, which is correct but slow.
+    virtual std::size_t Hash() const noexcept { return 0; }
+
     /// @brief Clone a delegate instance.
     /// @details Use Clone() to provide a deep copy using a base pointer. Covariant 
     /// overloading is used so that a Clone() method return type is a more 
@@ -66,6 +79,25 @@ public:
     // using operator new(). See DMQ_ALLOCATOR in DelegateOpt.h and 
     // ENABLE_ALLOCATOR in CMakeLists.txt.
     XALLOCATOR
+
+protected:
+    /// @brief Combine the object representation of a value into a hash.
+    /// @details Used to hash function and member function pointers, which 
+    /// `std::hash` does not support.
+    /// @param[in] value The value to hash.
+    /// @param[in] seed The hash to combine with.
+    /// @return The combined hash value.
+    template <class T>
+    static std::size_t HashValue(const T& value, std::size_t seed = 0) noexcept {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (std::size_t i = 0; i < sizeof(T); i += sizeof(std::size_t)) {
+            std::size_t word = 0;
+            std::memcpy(&word, bytes + i, (std::min)(sizeof(std::size_t), sizeof(T) - i));
+            seed ^= word + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
 };
 
 template <class R>
@@ -87,6 +119,42 @@ public:
     /// @return A new Delegate instance created on the heap. 
     /// @post The caller is responsible for deleting the instance.
     virtual Delegate* Clone() const = 0;
+
+    /// @brief Clone an instance of a Delegate instance within caller supplied storage. 
+    /// Used by `DelegateValue` to avoid heap allocation. 
+    /// @details Every class overriding `Clone()` must also override `CloneTo()` and 
+    /// `MoveTo()`, otherwise a copy of a derived class instance is sliced.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A new Delegate instance within `buffer` if it fits, otherwise a new 
+    /// instance created on the heap using `Clone()`. nullptr if allocation fails.
+    /// @post The caller is responsible for destroying an instance within `buffer` or 
+    /// deleting a heap instance.
+    virtual Delegate* CloneTo(void* buffer, std::size_t size) const { (void)buffer; (void)size; return Clone(); }
+
+    /// @brief Move this instance into caller supplied storage.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A new Delegate instance within `buffer`.
+    /// @pre This instance was created within storage of the same size by `CloneTo()`.
+    virtual Delegate* MoveTo(void* buffer) noexcept { (void)buffer; return nullptr; }
+
+    /// @brief Get the destination thread used for broadcast fusion. A multicast container 
+    /// delivers one call to all fusable delegates sharing a destination thread and priority 
+    /// using a single message. See `BroadcastFusion.h`.
+    /// @param[out] priority The message priority. Set only if a thread is returned.
+    /// @return The destination thread, or nullptr if the next call must be invoked 
+    /// individually using `operator()`. Synchronous delegates return nullptr.
+    virtual IThread* GetFusionThread(Priority& priority) const { (void)priority; return nullptr; }
+
+    /// @brief Get the shared immutable instance invoked by a fused broadcast message.
+    /// @return The instance, or nullptr if the delegate is not fusable.
+    virtual std::shared_ptr<Delegate> GetFusionInvoker() const { return nullptr; }
+
+    /// @brief Invoke the bound target function synchronously. Called by the destination 
+    /// thread on the fusion invoker instance.
+    /// @param[in] args The bound function argument(s), if any.
+    /// @return The bound function return value, if any.
+    virtual RetType InvokeTarget(Args... args) { return operator()(std::forward<Args>(args)...); }
 };
 
 template <class R>
@@ -147,6 +215,25 @@ public:
         return new(std::nothrow) ClassType(*this); 
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -200,6 +287,12 @@ public:
             m_func == derivedRhs->m_func;
     }
 
+    /// @brief Get a hash of the bound target identity.
+    /// @return The hash of the target function pointer.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateBase::HashValue(m_func);
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -359,6 +452,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -419,6 +531,12 @@ public:
             m_object == derivedRhs->m_object;
     }
 
+    /// @brief Get a hash of the bound target identity.
+    /// @return The hash of the object and member function pointers.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateBase::HashValue(m_func, DelegateBase::HashValue(m_object.get()));
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
@@ -509,7 +627,7 @@ public:
     DelegateMemberSp(const ClassType& rhs) { Assign(rhs); }
 
     /// @brief Move constructor.
-    DelegateMemberSp(ClassType&& rhs) noexcept : m_object(std::move(rhs.m_object)), m_func(rhs.m_func) { rhs.Clear(); }
+    DelegateMemberSp(ClassType&& rhs) noexcept : m_object(std::move(rhs.m_object)), m_ptr(rhs.m_ptr), m_func(rhs.m_func) { rhs.Clear(); }
 
     /// @brief Default constructor.
     DelegateMemberSp() = default;
@@ -521,12 +639,14 @@ public:
     void Bind(SharedPtr object, MemberFunc func) {
         static_assert(!std::is_const<TClass>::value, "Cannot bind non-const function to const object.");
         m_object = object; // Implicit conversion from shared_ptr to weak_ptr
+        m_ptr = object.get();
         m_func = func;
     }
 
     /// @brief Bind a const member function to the delegate.
     void Bind(SharedPtr object, ConstMemberFunc func) {
         m_object = object; // Implicit conversion from shared_ptr to weak_ptr
+        m_ptr = object.get();
         m_func = reinterpret_cast<MemberFunc>(func);
     }
 
@@ -535,9 +655,29 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assigns the state of one object to another.
     void Assign(const ClassType& rhs) {
         m_object = rhs.m_object;
+        m_ptr = rhs.m_ptr;
         m_func = rhs.m_func;
     }
 
@@ -570,6 +710,7 @@ public:
     ClassType& operator=(ClassType&& rhs) noexcept {
         if (&rhs != this) {
             m_object = std::move(rhs.m_object);
+            m_ptr = rhs.m_ptr;
             m_func = rhs.m_func;
             rhs.Clear();
         }
@@ -586,11 +727,20 @@ public:
         auto derivedRhs = dynamic_cast<const ClassType*>(&rhs);
         if (!derivedRhs) return false;
 
-        // Compare Weak Pointers by locking them first
-        auto ptr1 = m_object.lock();
-        auto ptr2 = derivedRhs->m_object.lock();
+        // Compare the target identity captured at bind. The weak pointers share an 
+        // owner if bound to the same object, whether or not it has expired.
+        return m_ptr == derivedRhs->m_ptr &&
+            !m_object.owner_before(derivedRhs->m_object) &&
+            !derivedRhs->m_object.owner_before(m_object) &&
+            m_func == derivedRhs->m_func;
+    }
 
-        return (ptr1 == ptr2) && (m_func == derivedRhs->m_func);
+    /// @brief Get a hash of the bound target identity.
+    /// @details Uses the object pointer captured at bind, so the hash does not change 
+    /// once the object expires.
+    /// @return The hash of the object and member function pointers.
+    virtual std::size_t Hash() const noexcept override {
+        return DelegateBase::HashValue(m_func, DelegateBase::HashValue(m_ptr));
     }
 
     // Standard operator== overloads
@@ -604,7 +754,7 @@ public:
     bool Empty() const noexcept { return m_object.expired() || !m_func; }
 
     /// @brief Clear the target function.
-    void Clear() noexcept { m_object.reset(); m_func = nullptr; }
+    void Clear() noexcept { m_object.reset(); m_ptr = nullptr; m_func = nullptr; }
 
     explicit operator bool() const noexcept { return !Empty(); }
 
@@ -614,6 +764,9 @@ private:
     /// Weak pointer to the target object.
     WeakPtr m_object; 
 
+    /// The target object address when bound. Identifies the target after it expires.
+    ObjectPtr m_ptr = nullptr;
+
     /// Pointer to a member function.
     MemberFunc m_func = nullptr;
 };
@@ -701,6 +854,25 @@ public:
         return new(std::nothrow) ClassType(*this); 
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -764,6 +936,13 @@ public:
         return false;  // Return false if dynamic cast failed
     }
 
+    /// @brief Get a hash of the bound target identity.
+    /// @return The hash of the callable target type, since `Equal()` compares 
+    /// the target type only.
+    virtual std::size_t Hash() const noexcept override {
+        return m_func ? m_func.target_type().hash_code() : 0;
+    }
+
     /// Compares two delegate objects for equality.
     /// @return `true` if the objects are equal, `false` otherwise.
     bool operator==(const ClassType& rhs) const noexcept { return Equal(rhs); }
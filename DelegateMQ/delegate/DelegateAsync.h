@@ -9,21 +9,22 @@
 /// @brief Delegate "`Async`" series of classes used to invoke a function asynchronously. 
 /// 
 /// @details The classes are not thread safe. Invoking a function asynchronously requires 
-/// sending a clone of the object to the destination thread message queue. The destination 
+/// sending a copy of the object to the destination thread message queue. The copy (invoker) 
+/// is created once when the target is bound and shared by all messages. The destination 
 /// thread calls `Invoke()` to invoke the target function.
 /// 
 /// A `IThread` implementation is required to serialize and dispatch an async delegate onto
 /// a destination thread of control. 
 /// 
-/// Argument data is created on the heap using `operator new` for transport thought a thread 
-/// message queue. An optional fixed-block allocator is available. See `DMQ_ALLOCATOR`. 
+/// Argument data is copied into the message object created using `operator new` for transport 
+/// thought a thread message queue. An optional fixed-block allocator is available. See `DMQ_ALLOCATOR`. 
 /// 
 /// `RetType operator()(Args... args)` - called by the source thread to initiate the async
 /// function call. May throw `std::bad_alloc` if dynamic storage allocation fails and `DMQ_ASSERTS` 
 /// is not defined. Clone() may also throw `std::bad_alloc` unless `DMQ_ASSERTS`. All other delegate 
 /// class functions do not throw exceptions.
 ///
-/// `void Invoke(std::shared_ptr<DelegateMsg> msg)` - called by the destination
+/// `bool Invoke(DelegateMsg& msg)` - called by the destination
 /// thread to invoke the target function. The destination thread must not call any other
 /// delegate instance functions.
 /// 
@@ -34,7 +35,9 @@
 /// 
 /// * Cannot use a `void*` as a target function argument.
 /// 
-/// * Cannot use rvalue reference (T&&) as a target function argument.
+/// * By value and rvalue reference (T&&) arguments are moved into the message and moved
+/// again into the target function. Pass an rvalue to transfer ownership of large or 
+/// move-only arguments (e.g. `std::vector`, `std::unique_ptr`) without a copy.
 /// 
 /// * Cannot insert `DelegateMemberAsync` into an ordered container. e.g. `std::list` ok, 
 /// `std::set` not ok.
@@ -51,7 +54,12 @@
 #include "Delegate.h"
 #include "IThread.h"
 #include "IInvoker.h"
+#include "MsgPool.h"
+#include "arg_storage.h"
+#include "Future.h"
 #include <tuple>
+#include <optional>
+#include <mutex>
 
 namespace dmq {
 
@@ -86,7 +94,7 @@ namespace trait
 }
 
 /// @brief Stores all function arguments suitable for non-blocking asynchronous calls.
-/// Argument data is stored in the heap.
+/// Argument data is stored inline within the message. See `arg_storage.h`.
 /// @tparam Args The argument types of the bound delegate function.
 template <class...Args>
 class DelegateAsyncMsg : public DelegateMsg
@@ -96,9 +104,13 @@ public:
     /// @param[in] invoker - the invoker instance
     /// @param[in] priority - the delegate message priority
     /// @param[in] args - a parameter pack of all target function arguments
-    /// @throws std::bad_alloc If make_tuble_heap() fails to obtain memory and DMQ_ASSERTS not defined.
-    DelegateAsyncMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : DelegateMsg(invoker, priority),
-        m_args(make_tuple_heap(m_heapMem, m_start, std::forward<Args>(args)...)) {
+    DelegateAsyncMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : 
+        DelegateMsg(std::move(invoker), priority, TypeIdOf<DelegateAsyncMsg>()),
+        m_args(std::forward<Args>(args)...) {
+        static_assert(!(
+            std::disjunction_v<std::conjunction<is_shared_ptr<Args>, std::disjunction<std::is_lvalue_reference<Args>, std::is_pointer<Args>>>...>),
+            "std::shared_ptr reference argument not allowed");
+        static_assert(!std::disjunction_v<std::is_same<Args, void*>...>, "void* argument not allowed");
     }
 
     /// Delete the default constructor
@@ -116,19 +128,93 @@ public:
 
     virtual ~DelegateAsyncMsg() = default;
 
-    /// Get all function arguments that were created on the heap
-    /// @return A tuple of all function arguments
-    std::tuple<Args...>& GetArgs() { return m_args; }
+    /// Invoke a callable with all stored function arguments
+    /// @param[in] func - a callable accepting the target function arguments
+    template <class F>
+    void Apply(F&& func) {
+        std::apply([&func](auto&... arg) { func(arg.get()...); }, m_args);
+    }
 
 private:
-    /// A list of heap allocated argument memory blocks
-    xlist<std::shared_ptr<heap_arg_deleter_base>> m_heapMem;
+    /// A tuple with a copy of each argument stored within the message
+    std::tuple<arg_storage<Args>...> m_args;
+};
+
+/// @brief Conflation state shared by a conflating async delegate and its copies.
+/// @details At most one message per slot waits in the destination thread queue. 
+/// Newer calls replace the pending arguments and the queued message invokes the 
+/// target with the latest arguments.
+/// @tparam Args The argument types of the bound delegate function.
+template <class...Args>
+struct DelegateConflateSlot
+{
+    /// Lock protecting the slot members
+    std::mutex lock;
+
+    /// The most recent function arguments not yet invoked. The message has no invoker.
+    MsgPtr<DelegateAsyncMsg<Args...>> latest;
+
+    /// The message waiting in the destination thread queue, if any
+    DelegateMsg* queued = nullptr;
+};
+
+/// @brief Message dispatched by a conflating async delegate. Carries no arguments; 
+/// the invoker uses the latest arguments stored in the slot. 
+/// @tparam Args The argument types of the bound delegate function.
+template <class...Args>
+class DelegateConflateMsg : public DelegateMsg
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the invoker instance
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] slot - the conflation slot shared with the delegate
+    DelegateConflateMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, std::shared_ptr<DelegateConflateSlot<Args...>> slot) :
+        DelegateMsg(std::move(invoker), priority, TypeIdOf<DelegateConflateMsg>()), m_slot(std::move(slot)) {
+    }
 
-    /// An empty starting tuple
-    std::tuple<> m_start;
+    /// Destructor. A message discarded without being invoked (e.g. expired or thread 
+    /// exit) allows the next call to queue a new message.
+    virtual ~DelegateConflateMsg() {
+        std::lock_guard<std::mutex> lock(m_slot->lock);
+        if (m_slot->queued == this)
+            m_slot->queued = nullptr;
+    }
+
+private:
+    std::shared_ptr<DelegateConflateSlot<Args...>> m_slot;
+};
+
+/// @brief Message dispatched by `AsyncInvokeFuture()`. Stores the function arguments
+/// and the future state holding the return value.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+template <class RetType, class...Args>
+class DelegateFutureMsg : public FutureState<RetType>
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the invoker instance
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateFutureMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) :
+        FutureState<RetType>(std::move(invoker), priority, DelegateMsg::TypeIdOf<DelegateFutureMsg>()),
+        m_args(std::forward<Args>(args)...) {
+    }
+
+    DelegateFutureMsg(const DelegateFutureMsg&) = delete;
+    DelegateFutureMsg& operator=(const DelegateFutureMsg&) = delete;
+
+    /// Invoke a callable with all stored function arguments
+    /// @param[in] func - a callable accepting the target function arguments
+    template <class F>
+    decltype(auto) Apply(F&& func) {
+        return std::apply([&func](auto&... arg) -> decltype(auto) { return func(arg.get()...); }, m_args);
+    }
 
-    /// A tuple with each element stored within the heap
-    std::tuple<Args...> m_args;
+private:
+    /// A tuple with a copy of each argument stored within the message
+    std::tuple<arg_storage<Args>...> m_args;
 };
 
 template <class R>
@@ -165,7 +251,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFreeAsync(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_lifetime(rhs.m_lifetime), m_inlineSameThread(rhs.m_inlineSameThread), m_conflate(rhs.m_conflate), m_invoker(std::move(rhs.m_invoker)) {
         rhs.Clear();
     }
 
@@ -180,6 +266,7 @@ public:
     void Bind(FreeFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(func);
+        m_invoker = nullptr;
     }
 
     // <common_code>
@@ -191,6 +278,10 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_priority = rhs.m_priority;
+        m_lifetime = rhs.m_lifetime;
+        m_inlineSameThread = rhs.m_inlineSameThread;
+        m_conflate = rhs.m_conflate;
+        m_invoker = rhs.m_invoker;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -203,6 +294,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -222,6 +332,10 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_priority = rhs.m_priority;
+            m_lifetime = rhs.m_lifetime;
+            m_inlineSameThread = rhs.m_inlineSameThread;
+            m_conflate = rhs.m_conflate;
+            m_invoker = std::move(rhs.m_invoker);
             rhs.Clear();
         }
         return *this;
@@ -277,9 +391,10 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. By value and rvalue
+    /// reference arguments are moved instead of copied. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -290,28 +405,62 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
+        // Caller already executing on the destination thread invokes directly, if enabled
+        if (m_inlineSameThread && m_thread && m_thread->IsCurrentThread())
             return BaseType::operator()(std::forward<Args>(args)...);
-        }
-        else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
+
+        // Shared invoker is created by the first call, so a temporary delegate that is
+        // never called (e.g. passed to `operator-=`) allocates nothing
+        auto& invoker = GetInvoker();
+
+        if (m_conflate) {
+            // Store the latest arguments. Message has no invoker; it only holds arguments.
+            auto argMsg = MakeMsg<DelegateAsyncMsg<Args...>>(nullptr, m_priority, std::forward<Args>(args)...);
+            if (!argMsg)
                 BAD_ALLOC();
 
-            // Create a new message instance for sending to the destination thread
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncMsg<Args...>> msg(new DelegateAsyncMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            MsgPtr<DelegateConflateMsg<Args...>> msg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                m_conflate->latest = std::move(argMsg);
+
+                // A queued message will invoke the target with the latest arguments
+                if (m_conflate->queued)
+                    return RetType();
+
+                // Queued message carries no arguments. Invoke() uses the slot arguments.
+                msg = MakeMsg<DelegateConflateMsg<Args...>>(invoker, m_priority, m_conflate);
+                if (!msg)
+                    BAD_ALLOC();
+                m_conflate->queued = msg.get();
+            }
+
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+            // Dispatch outside the slot lock. A discarded message locks the slot.
+            auto thread = this->GetThread();
+            if (thread)
+                thread->DispatchDelegate(std::move(msg));
+            return RetType();
+        }
+        else {
+            // Create a new message instance for sending to the destination thread. All 
+            // messages share the same immutable invoker instance.
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncMsg<Args...>>(invoker, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            // Message expires if not invoked within the lifetime
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destintation thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(std::move(msg));
             }
 
             // Do not wait for destination thread return value from async function call
@@ -335,26 +484,87 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the 
+    /// return value. Called by the source thread. Does not wait for the target function.
+    /// @details Unlike `DelegateAsyncWait`, the source thread is not blocked. Use the
+    /// future to wait for, poll or chain a continuation on the return value. Several 
+    /// futures may be outstanding at once; see `WhenAll()`. Conflation does not apply; 
+    /// each call dispatches a message.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future. Not valid if the delegate is empty or has no thread.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    Future<RetType> AsyncInvokeFuture(Args... args) {
+        auto thread = this->GetThread();
+        if (this->Empty() || !thread)
+            return Future<RetType>();
+
+        auto& invoker = GetInvoker();
+
+        // Message holds the arguments and the future state
+        auto msg = MakeMsg<DelegateFutureMsg<RetType, Args...>>(invoker, m_priority, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+
+        if (m_lifetime.has_value())
+            msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+        Future<RetType> future(msg.Share());
+
+        // Caller executing on the destination thread invokes directly. A queued call 
+        // could never complete while the caller waits on the future.
+        if (thread->IsCurrentThread())
+            invoker->Invoke(*msg);
+        else
+            thread->DispatchDelegate(std::move(msg));
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. Unlike `DelegateAsyncWait`, a lock is not required between 
+    /// on the destination thread. Called on the shared invoker instance, which is not 
+    /// modified. Unlike `DelegateAsyncWait`, a lock is not required between 
     /// source and destination `delegateMsg` access because the source thread is not waiting 
     /// for the function call to complete.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+    virtual bool Invoke(DelegateMsg& msg) override {
+        // Future message stores the return value for the waiting source thread
+        if (auto futureMsg = MsgCast<DelegateFutureMsg<RetType, Args...>>(msg)) {
+            auto call = [this](auto&&... args) -> RetType { return this->BaseType::operator()(std::forward<decltype(args)>(args)...); };
+            if constexpr (std::is_void_v<RetType>) {
+                futureMsg->Apply(call);
+                futureMsg->SetValue(true);
+            }
+            else {
+                futureMsg->SetValue(futureMsg->Apply(call));
+            }
+            return true;
+        }
+
+        // Conflating delegate invokes the latest arguments stored in the slot
+        if (m_conflate) {
+            MsgPtr<DelegateAsyncMsg<Args...>> argMsg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                argMsg = std::move(m_conflate->latest);
+                m_conflate->queued = nullptr;
+            }
+            if (!argMsg)
+                return true;
+
+            argMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
+            return true;
+        }
+
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
-
-        // Invoke the target function using the source thread supplied function arguments
-        std::apply(&BaseType::operator(),
-            std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+        // Invoke the target function synchronously using the source thread supplied 
+        // function arguments. The qualified call bypasses the virtual async operator().
+        delegateMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
         return true;
     }
 
@@ -367,16 +577,117 @@ public:
     Priority GetPriority() const noexcept { return m_priority; }
     void SetPriority(Priority priority) noexcept { m_priority = priority; }
 
+    /// @brief Get the delegate message lifetime
+    /// @return The message lifetime, or std::nullopt if messages never expire.
+    std::optional<Duration> GetLifetime() const noexcept { return m_lifetime; }
+
+    /// @brief Set the delegate message lifetime. Each message dispatched by `operator()` 
+    /// is given a deadline of now plus `lifetime`. The destination thread invokes messages 
+    /// of equal priority earliest deadline first and discards messages not invoked before 
+    /// their deadline. The lifetime is not used by `Equal()`.
+    /// @param[in] lifetime The message lifetime, or std::nullopt to never expire.
+    void SetLifetime(std::optional<Duration> lifetime) noexcept { m_lifetime = lifetime; }
+
+    /// @brief Get the same thread inline mode
+    /// @return `true` if calls made on the destination thread are invoked synchronously.
+    bool GetInlineSameThread() const noexcept { return m_inlineSameThread; }
+
+    /// @brief Invoke the target function synchronously, without queuing a message, when 
+    /// `operator()` is called from the destination thread. Disabled by default since an 
+    /// inline call runs ahead of messages already queued to the thread. The mode is not 
+    /// used by `Equal()`.
+    /// @param[in] inlineSameThread `true` to enable.
+    void SetInlineSameThread(bool inlineSameThread) noexcept { m_inlineSameThread = inlineSameThread; }
+
+    /// @brief Get the conflation mode
+    /// @return `true` if conflation is enabled.
+    bool GetConflate() const noexcept { return m_conflate != nullptr; }
+
+    /// @brief Enable or disable conflation ("latest value wins"). When enabled, a call 
+    /// made while a previous call is still queued on the destination thread replaces 
+    /// the queued arguments instead of queuing another message. Copies of this delegate 
+    /// made after enabling share the same pending message. The mode is not used by `Equal()`.
+    /// @param[in] conflate `true` to enable conflation.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void SetConflate(bool conflate) {
+        if (conflate == GetConflate())
+            return;
+        if (!conflate)
+            m_conflate = nullptr;
+        else {
+            m_conflate = std::shared_ptr<DelegateConflateSlot<Args...>>(new(std::nothrow) DelegateConflateSlot<Args...>());
+            if (!m_conflate)
+                BAD_ALLOC();
+        }
+
+        // Invoker must share the new conflation state; created by the next call
+        m_invoker = nullptr;
+    }
+
+    /// @brief Get the destination thread used for broadcast fusion. See 
+    /// `Delegate::GetFusionThread()`. Conflating, expiring and same thread inline 
+    /// calls are not fused.
+    /// @param[out] priority The message priority.
+    /// @return The destination thread, or nullptr if the call is not fusable.
+    virtual IThread* GetFusionThread(Priority& priority) const override {
+        if (this->Empty() || !m_thread || m_conflate || m_lifetime.has_value())
+            return nullptr;
+        if (m_inlineSameThread && m_thread->IsCurrentThread())
+            return nullptr;
+        priority = m_priority;
+        return m_thread;
+    }
+
+    /// @brief Get the shared invoker instance. See `Delegate::GetFusionInvoker()`.
+    /// @return The immutable copy of this delegate shared by all dispatched messages.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    virtual std::shared_ptr<Delegate<RetType(Args...)>> GetFusionInvoker() const override {
+        return GetInvoker();
+    }
+
+    /// @brief Invoke the target function synchronously. Called by the destination 
+    /// thread on the shared invoker instance when a fused broadcast message is received.
+    /// @param[in] args The function arguments, if any.
+    /// @return The target function return value.
+    virtual RetType InvokeTarget(Args... args) override {
+        return BaseType::operator()(std::forward<Args>(args)...);
+    }
+
 private:
+    /// @brief Get the shared invoker instance sent with each message. Created on first 
+    /// use. Like the other delegate members, not safe to call from several threads at 
+    /// once on the same delegate instance; use a thread-safe container to share one.
+    /// @return The shared invoker instance.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    const std::shared_ptr<ClassType>& GetInvoker() const {
+        if (!m_invoker) {
+            // The clone is created with no invoker of its own
+            m_invoker = std::shared_ptr<ClassType>(Clone());
+            if (!m_invoker)
+                BAD_ALLOC();
+        }
+        return m_invoker;
+    }
+
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
 
+    /// The delegate message lifetime
+    std::optional<Duration> m_lifetime;
+
+    /// Invoke synchronously when called from the destination thread
+    bool m_inlineSameThread = false;
+
+    /// The conflation state shared with copies, or nullptr if not conflating
+    std::shared_ptr<DelegateConflateSlot<Args...>> m_conflate;
+
+    /// The immutable copy of this delegate shared by all dispatched messages, or 
+    /// nullptr until first used
+    mutable std::shared_ptr<ClassType> m_invoker;
+
     // </common_code>
 };
 
@@ -442,7 +753,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateMemberAsync(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_lifetime(rhs.m_lifetime), m_inlineSameThread(rhs.m_inlineSameThread), m_conflate(rhs.m_conflate), m_invoker(std::move(rhs.m_invoker)) {
         rhs.Clear();
     }
 
@@ -458,6 +769,7 @@ public:
     void Bind(SharedPtr object, MemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     /// @brief Bind a const member function to the delegate.
@@ -470,6 +782,7 @@ public:
     void Bind(SharedPtr object, ConstMemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     /// @brief Bind a member function to the delegate.
@@ -482,6 +795,7 @@ public:
     void Bind(ObjectPtr object, MemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     /// @brief Bind a const member function to the delegate.
@@ -494,6 +808,7 @@ public:
     void Bind(ObjectPtr object, ConstMemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     // <common_code>
@@ -505,6 +820,10 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_priority = rhs.m_priority;
+        m_lifetime = rhs.m_lifetime;
+        m_inlineSameThread = rhs.m_inlineSameThread;
+        m_conflate = rhs.m_conflate;
+        m_invoker = rhs.m_invoker;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -517,6 +836,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -536,6 +874,10 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_priority = rhs.m_priority;
+            m_lifetime = rhs.m_lifetime;
+            m_inlineSameThread = rhs.m_inlineSameThread;
+            m_conflate = rhs.m_conflate;
+            m_invoker = std::move(rhs.m_invoker);
             rhs.Clear();
         }
         return *this;
@@ -591,9 +933,10 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. By value and rvalue
+    /// reference arguments are moved instead of copied. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -604,28 +947,62 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
+        // Caller already executing on the destination thread invokes directly, if enabled
+        if (m_inlineSameThread && m_thread && m_thread->IsCurrentThread())
             return BaseType::operator()(std::forward<Args>(args)...);
-        }
-        else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
+
+        // Shared invoker is created by the first call, so a temporary delegate that is
+        // never called (e.g. passed to `operator-=`) allocates nothing
+        auto& invoker = GetInvoker();
+
+        if (m_conflate) {
+            // Store the latest arguments. Message has no invoker; it only holds arguments.
+            auto argMsg = MakeMsg<DelegateAsyncMsg<Args...>>(nullptr, m_priority, std::forward<Args>(args)...);
+            if (!argMsg)
                 BAD_ALLOC();
 
-            // Create a new message instance for sending to the destination thread
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncMsg<Args...>> msg(new DelegateAsyncMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            MsgPtr<DelegateConflateMsg<Args...>> msg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                m_conflate->latest = std::move(argMsg);
+
+                // A queued message will invoke the target with the latest arguments
+                if (m_conflate->queued)
+                    return RetType();
+
+                // Queued message carries no arguments. Invoke() uses the slot arguments.
+                msg = MakeMsg<DelegateConflateMsg<Args...>>(invoker, m_priority, m_conflate);
+                if (!msg)
+                    BAD_ALLOC();
+                m_conflate->queued = msg.get();
+            }
+
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+            // Dispatch outside the slot lock. A discarded message locks the slot.
+            auto thread = this->GetThread();
+            if (thread)
+                thread->DispatchDelegate(std::move(msg));
+            return RetType();
+        }
+        else {
+            // Create a new message instance for sending to the destination thread. All 
+            // messages share the same immutable invoker instance.
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncMsg<Args...>>(invoker, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            // Message expires if not invoked within the lifetime
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destintation thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(std::move(msg));
             }
 
             // Do not wait for destination thread return value from async function call
@@ -649,26 +1026,87 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the 
+    /// return value. Called by the source thread. Does not wait for the target function.
+    /// @details Unlike `DelegateAsyncWait`, the source thread is not blocked. Use the
+    /// future to wait for, poll or chain a continuation on the return value. Several 
+    /// futures may be outstanding at once; see `WhenAll()`. Conflation does not apply; 
+    /// each call dispatches a message.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future. Not valid if the delegate is empty or has no thread.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    Future<RetType> AsyncInvokeFuture(Args... args) {
+        auto thread = this->GetThread();
+        if (this->Empty() || !thread)
+            return Future<RetType>();
+
+        auto& invoker = GetInvoker();
+
+        // Message holds the arguments and the future state
+        auto msg = MakeMsg<DelegateFutureMsg<RetType, Args...>>(invoker, m_priority, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+
+        if (m_lifetime.has_value())
+            msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+        Future<RetType> future(msg.Share());
+
+        // Caller executing on the destination thread invokes directly. A queued call 
+        // could never complete while the caller waits on the future.
+        if (thread->IsCurrentThread())
+            invoker->Invoke(*msg);
+        else
+            thread->DispatchDelegate(std::move(msg));
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. Unlike `DelegateAsyncWait`, a lock is not required between 
+    /// on the destination thread. Called on the shared invoker instance, which is not 
+    /// modified. Unlike `DelegateAsyncWait`, a lock is not required between 
     /// source and destination `delegateMsg` access because the source thread is not waiting 
     /// for the function call to complete.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+    virtual bool Invoke(DelegateMsg& msg) override {
+        // Future message stores the return value for the waiting source thread
+        if (auto futureMsg = MsgCast<DelegateFutureMsg<RetType, Args...>>(msg)) {
+            auto call = [this](auto&&... args) -> RetType { return this->BaseType::operator()(std::forward<decltype(args)>(args)...); };
+            if constexpr (std::is_void_v<RetType>) {
+                futureMsg->Apply(call);
+                futureMsg->SetValue(true);
+            }
+            else {
+                futureMsg->SetValue(futureMsg->Apply(call));
+            }
+            return true;
+        }
+
+        // Conflating delegate invokes the latest arguments stored in the slot
+        if (m_conflate) {
+            MsgPtr<DelegateAsyncMsg<Args...>> argMsg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                argMsg = std::move(m_conflate->latest);
+                m_conflate->queued = nullptr;
+            }
+            if (!argMsg)
+                return true;
+
+            argMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
+            return true;
+        }
+
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
-
-        // Invoke the target function using the source thread supplied function arguments
-        std::apply(&BaseType::operator(),
-            std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+        // Invoke the target function synchronously using the source thread supplied 
+        // function arguments. The qualified call bypasses the virtual async operator().
+        delegateMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
         return true;
     }
 
@@ -681,16 +1119,117 @@ public:
     Priority GetPriority() const noexcept { return m_priority; }
     void SetPriority(Priority priority) noexcept { m_priority = priority; }
 
+    /// @brief Get the delegate message lifetime
+    /// @return The message lifetime, or std::nullopt if messages never expire.
+    std::optional<Duration> GetLifetime() const noexcept { return m_lifetime; }
+
+    /// @brief Set the delegate message lifetime. Each message dispatched by `operator()` 
+    /// is given a deadline of now plus `lifetime`. The destination thread invokes messages 
+    /// of equal priority earliest deadline first and discards messages not invoked before 
+    /// their deadline. The lifetime is not used by `Equal()`.
+    /// @param[in] lifetime The message lifetime, or std::nullopt to never expire.
+    void SetLifetime(std::optional<Duration> lifetime) noexcept { m_lifetime = lifetime; }
+
+    /// @brief Get the same thread inline mode
+    /// @return `true` if calls made on the destination thread are invoked synchronously.
+    bool GetInlineSameThread() const noexcept { return m_inlineSameThread; }
+
+    /// @brief Invoke the target function synchronously, without queuing a message, when 
+    /// `operator()` is called from the destination thread. Disabled by default since an 
+    /// inline call runs ahead of messages already queued to the thread. The mode is not 
+    /// used by `Equal()`.
+    /// @param[in] inlineSameThread `true` to enable.
+    void SetInlineSameThread(bool inlineSameThread) noexcept { m_inlineSameThread = inlineSameThread; }
+
+    /// @brief Get the conflation mode
+    /// @return `true` if conflation is enabled.
+    bool GetConflate() const noexcept { return m_conflate != nullptr; }
+
+    /// @brief Enable or disable conflation ("latest value wins"). When enabled, a call 
+    /// made while a previous call is still queued on the destination thread replaces 
+    /// the queued arguments instead of queuing another message. Copies of this delegate 
+    /// made after enabling share the same pending message. The mode is not used by `Equal()`.
+    /// @param[in] conflate `true` to enable conflation.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void SetConflate(bool conflate) {
+        if (conflate == GetConflate())
+            return;
+        if (!conflate)
+            m_conflate = nullptr;
+        else {
+            m_conflate = std::shared_ptr<DelegateConflateSlot<Args...>>(new(std::nothrow) DelegateConflateSlot<Args...>());
+            if (!m_conflate)
+                BAD_ALLOC();
+        }
+
+        // Invoker must share the new conflation state; created by the next call
+        m_invoker = nullptr;
+    }
+
+    /// @brief Get the destination thread used for broadcast fusion. See 
+    /// `Delegate::GetFusionThread()`. Conflating, expiring and same thread inline 
+    /// calls are not fused.
+    /// @param[out] priority The message priority.
+    /// @return The destination thread, or nullptr if the call is not fusable.
+    virtual IThread* GetFusionThread(Priority& priority) const override {
+        if (this->Empty() || !m_thread || m_conflate || m_lifetime.has_value())
+            return nullptr;
+        if (m_inlineSameThread && m_thread->IsCurrentThread())
+            return nullptr;
+        priority = m_priority;
+        return m_thread;
+    }
+
+    /// @brief Get the shared invoker instance. See `Delegate::GetFusionInvoker()`.
+    /// @return The immutable copy of this delegate shared by all dispatched messages.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    virtual std::shared_ptr<Delegate<RetType(Args...)>> GetFusionInvoker() const override {
+        return GetInvoker();
+    }
+
+    /// @brief Invoke the target function synchronously. Called by the destination 
+    /// thread on the shared invoker instance when a fused broadcast message is received.
+    /// @param[in] args The function arguments, if any.
+    /// @return The target function return value.
+    virtual RetType InvokeTarget(Args... args) override {
+        return BaseType::operator()(std::forward<Args>(args)...);
+    }
+
 private:
+    /// @brief Get the shared invoker instance sent with each message. Created on first 
+    /// use. Like the other delegate members, not safe to call from several threads at 
+    /// once on the same delegate instance; use a thread-safe container to share one.
+    /// @return The shared invoker instance.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    const std::shared_ptr<ClassType>& GetInvoker() const {
+        if (!m_invoker) {
+            // The clone is created with no invoker of its own
+            m_invoker = std::shared_ptr<ClassType>(Clone());
+            if (!m_invoker)
+                BAD_ALLOC();
+        }
+        return m_invoker;
+    }
+
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
 
+    /// The delegate message lifetime
+    std::optional<Duration> m_lifetime;
+
+    /// Invoke synchronously when called from the destination thread
+    bool m_inlineSameThread = false;
+
+    /// The conflation state shared with copies, or nullptr if not conflating
+    std::shared_ptr<DelegateConflateSlot<Args...>> m_conflate;
+
+    /// The immutable copy of this delegate shared by all dispatched messages, or 
+    /// nullptr until first used
+    mutable std::shared_ptr<ClassType> m_invoker;
+
     // </common_code>
 };
 
@@ -723,7 +1262,7 @@ public:
     DelegateMemberAsyncSp(const ClassType& rhs) : BaseType(rhs) { Assign(rhs); }
 
     DelegateMemberAsyncSp(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_lifetime(rhs.m_lifetime), m_inlineSameThread(rhs.m_inlineSameThread), m_conflate(rhs.m_conflate), m_invoker(std::move(rhs.m_invoker)) {
         rhs.Clear();
     }
 
@@ -732,11 +1271,13 @@ public:
     void Bind(SharedPtr object, MemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     void Bind(SharedPtr object, ConstMemberFunc func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(object, func);
+        m_invoker = nullptr;
     }
 
     // <common_code>
@@ -748,6 +1289,10 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_priority = rhs.m_priority;
+        m_lifetime = rhs.m_lifetime;
+        m_inlineSameThread = rhs.m_inlineSameThread;
+        m_conflate = rhs.m_conflate;
+        m_invoker = rhs.m_invoker;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -760,6 +1305,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -779,6 +1343,10 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_priority = rhs.m_priority;
+            m_lifetime = rhs.m_lifetime;
+            m_inlineSameThread = rhs.m_inlineSameThread;
+            m_conflate = rhs.m_conflate;
+            m_invoker = std::move(rhs.m_invoker);
             rhs.Clear();
         }
         return *this;
@@ -834,9 +1402,10 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. By value and rvalue
+    /// reference arguments are moved instead of copied. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -847,28 +1416,62 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
+        // Caller already executing on the destination thread invokes directly, if enabled
+        if (m_inlineSameThread && m_thread && m_thread->IsCurrentThread())
             return BaseType::operator()(std::forward<Args>(args)...);
-        }
-        else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
+
+        // Shared invoker is created by the first call, so a temporary delegate that is
+        // never called (e.g. passed to `operator-=`) allocates nothing
+        auto& invoker = GetInvoker();
+
+        if (m_conflate) {
+            // Store the latest arguments. Message has no invoker; it only holds arguments.
+            auto argMsg = MakeMsg<DelegateAsyncMsg<Args...>>(nullptr, m_priority, std::forward<Args>(args)...);
+            if (!argMsg)
                 BAD_ALLOC();
 
-            // Create a new message instance for sending to the destination thread
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncMsg<Args...>> msg(new DelegateAsyncMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            MsgPtr<DelegateConflateMsg<Args...>> msg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                m_conflate->latest = std::move(argMsg);
+
+                // A queued message will invoke the target with the latest arguments
+                if (m_conflate->queued)
+                    return RetType();
+
+                // Queued message carries no arguments. Invoke() uses the slot arguments.
+                msg = MakeMsg<DelegateConflateMsg<Args...>>(invoker, m_priority, m_conflate);
+                if (!msg)
+                    BAD_ALLOC();
+                m_conflate->queued = msg.get();
+            }
+
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+            // Dispatch outside the slot lock. A discarded message locks the slot.
+            auto thread = this->GetThread();
+            if (thread)
+                thread->DispatchDelegate(std::move(msg));
+            return RetType();
+        }
+        else {
+            // Create a new message instance for sending to the destination thread. All 
+            // messages share the same immutable invoker instance.
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncMsg<Args...>>(invoker, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            // Message expires if not invoked within the lifetime
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destintation thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(std::move(msg));
             }
 
             // Do not wait for destination thread return value from async function call
@@ -892,26 +1495,87 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the 
+    /// return value. Called by the source thread. Does not wait for the target function.
+    /// @details Unlike `DelegateAsyncWait`, the source thread is not blocked. Use the
+    /// future to wait for, poll or chain a continuation on the return value. Several 
+    /// futures may be outstanding at once; see `WhenAll()`. Conflation does not apply; 
+    /// each call dispatches a message.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future. Not valid if the delegate is empty or has no thread.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    Future<RetType> AsyncInvokeFuture(Args... args) {
+        auto thread = this->GetThread();
+        if (this->Empty() || !thread)
+            return Future<RetType>();
+
+        auto& invoker = GetInvoker();
+
+        // Message holds the arguments and the future state
+        auto msg = MakeMsg<DelegateFutureMsg<RetType, Args...>>(invoker, m_priority, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+
+        if (m_lifetime.has_value())
+            msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+        Future<RetType> future(msg.Share());
+
+        // Caller executing on the destination thread invokes directly. A queued call 
+        // could never complete while the caller waits on the future.
+        if (thread->IsCurrentThread())
+            invoker->Invoke(*msg);
+        else
+            thread->DispatchDelegate(std::move(msg));
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. Unlike `DelegateAsyncWait`, a lock is not required between 
+    /// on the destination thread. Called on the shared invoker instance, which is not 
+    /// modified. Unlike `DelegateAsyncWait`, a lock is not required between 
     /// source and destination `delegateMsg` access because the source thread is not waiting 
     /// for the function call to complete.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+    virtual bool Invoke(DelegateMsg& msg) override {
+        // Future message stores the return value for the waiting source thread
+        if (auto futureMsg = MsgCast<DelegateFutureMsg<RetType, Args...>>(msg)) {
+            auto call = [this](auto&&... args) -> RetType { return this->BaseType::operator()(std::forward<decltype(args)>(args)...); };
+            if constexpr (std::is_void_v<RetType>) {
+                futureMsg->Apply(call);
+                futureMsg->SetValue(true);
+            }
+            else {
+                futureMsg->SetValue(futureMsg->Apply(call));
+            }
+            return true;
+        }
+
+        // Conflating delegate invokes the latest arguments stored in the slot
+        if (m_conflate) {
+            MsgPtr<DelegateAsyncMsg<Args...>> argMsg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                argMsg = std::move(m_conflate->latest);
+                m_conflate->queued = nullptr;
+            }
+            if (!argMsg)
+                return true;
+
+            argMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
+            return true;
+        }
+
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
-
-        // Invoke the target function using the source thread supplied function arguments
-        std::apply(&BaseType::operator(),
-            std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+        // Invoke the target function synchronously using the source thread supplied 
+        // function arguments. The qualified call bypasses the virtual async operator().
+        delegateMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
         return true;
     }
 
@@ -924,16 +1588,117 @@ public:
     Priority GetPriority() const noexcept { return m_priority; }
     void SetPriority(Priority priority) noexcept { m_priority = priority; }
 
+    /// @brief Get the delegate message lifetime
+    /// @return The message lifetime, or std::nullopt if messages never expire.
+    std::optional<Duration> GetLifetime() const noexcept { return m_lifetime; }
+
+    /// @brief Set the delegate message lifetime. Each message dispatched by `operator()` 
+    /// is given a deadline of now plus `lifetime`. The destination thread invokes messages 
+    /// of equal priority earliest deadline first and discards messages not invoked before 
+    /// their deadline. The lifetime is not used by `Equal()`.
+    /// @param[in] lifetime The message lifetime, or std::nullopt to never expire.
+    void SetLifetime(std::optional<Duration> lifetime) noexcept { m_lifetime = lifetime; }
+
+    /// @brief Get the same thread inline mode
+    /// @return `true` if calls made on the destination thread are invoked synchronously.
+    bool GetInlineSameThread() const noexcept { return m_inlineSameThread; }
+
+    /// @brief Invoke the target function synchronously, without queuing a message, when 
+    /// `operator()` is called from the destination thread. Disabled by default since an 
+    /// inline call runs ahead of messages already queued to the thread. The mode is not 
+    /// used by `Equal()`.
+    /// @param[in] inlineSameThread `true` to enable.
+    void SetInlineSameThread(bool inlineSameThread) noexcept { m_inlineSameThread = inlineSameThread; }
+
+    /// @brief Get the conflation mode
+    /// @return `true` if conflation is enabled.
+    bool GetConflate() const noexcept { return m_conflate != nullptr; }
+
+    /// @brief Enable or disable conflation ("latest value wins"). When enabled, a call 
+    /// made while a previous call is still queued on the destination thread replaces 
+    /// the queued arguments instead of queuing another message. Copies of this delegate 
+    /// made after enabling share the same pending message. The mode is not used by `Equal()`.
+    /// @param[in] conflate `true` to enable conflation.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void SetConflate(bool conflate) {
+        if (conflate == GetConflate())
+            return;
+        if (!conflate)
+            m_conflate = nullptr;
+        else {
+            m_conflate = std::shared_ptr<DelegateConflateSlot<Args...>>(new(std::nothrow) DelegateConflateSlot<Args...>());
+            if (!m_conflate)
+                BAD_ALLOC();
+        }
+
+        // Invoker must share the new conflation state; created by the next call
+        m_invoker = nullptr;
+    }
+
+    /// @brief Get the destination thread used for broadcast fusion. See 
+    /// `Delegate::GetFusionThread()`. Conflating, expiring and same thread inline 
+    /// calls are not fused.
+    /// @param[out] priority The message priority.
+    /// @return The destination thread, or nullptr if the call is not fusable.
+    virtual IThread* GetFusionThread(Priority& priority) const override {
+        if (this->Empty() || !m_thread || m_conflate || m_lifetime.has_value())
+            return nullptr;
+        if (m_inlineSameThread && m_thread->IsCurrentThread())
+            return nullptr;
+        priority = m_priority;
+        return m_thread;
+    }
+
+    /// @brief Get the shared invoker instance. See `Delegate::GetFusionInvoker()`.
+    /// @return The immutable copy of this delegate shared by all dispatched messages.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    virtual std::shared_ptr<Delegate<RetType(Args...)>> GetFusionInvoker() const override {
+        return GetInvoker();
+    }
+
+    /// @brief Invoke the target function synchronously. Called by the destination 
+    /// thread on the shared invoker instance when a fused broadcast message is received.
+    /// @param[in] args The function arguments, if any.
+    /// @return The target function return value.
+    virtual RetType InvokeTarget(Args... args) override {
+        return BaseType::operator()(std::forward<Args>(args)...);
+    }
+
 private:
+    /// @brief Get the shared invoker instance sent with each message. Created on first 
+    /// use. Like the other delegate members, not safe to call from several threads at 
+    /// once on the same delegate instance; use a thread-safe container to share one.
+    /// @return The shared invoker instance.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    const std::shared_ptr<ClassType>& GetInvoker() const {
+        if (!m_invoker) {
+            // The clone is created with no invoker of its own
+            m_invoker = std::shared_ptr<ClassType>(Clone());
+            if (!m_invoker)
+                BAD_ALLOC();
+        }
+        return m_invoker;
+    }
+
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
 
+    /// The delegate message lifetime
+    std::optional<Duration> m_lifetime;
+
+    /// Invoke synchronously when called from the destination thread
+    bool m_inlineSameThread = false;
+
+    /// The conflation state shared with copies, or nullptr if not conflating
+    std::shared_ptr<DelegateConflateSlot<Args...>> m_conflate;
+
+    /// The immutable copy of this delegate shared by all dispatched messages, or 
+    /// nullptr until first used
+    mutable std::shared_ptr<ClassType> m_invoker;
+
     // </common_code>
 };
 
@@ -977,7 +1742,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFunctionAsync(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_lifetime(rhs.m_lifetime), m_inlineSameThread(rhs.m_inlineSameThread), m_conflate(rhs.m_conflate), m_invoker(std::move(rhs.m_invoker)) {
         rhs.Clear();
     }
 
@@ -992,6 +1757,7 @@ public:
     void Bind(FunctionType func, IThread& thread) {
         m_thread = &thread;
         BaseType::Bind(func);
+        m_invoker = nullptr;
     }
 
     // <common_code>
@@ -1003,6 +1769,10 @@ public:
     void Assign(const ClassType& rhs) {
         m_thread = rhs.m_thread;
         m_priority = rhs.m_priority;
+        m_lifetime = rhs.m_lifetime;
+        m_inlineSameThread = rhs.m_inlineSameThread;
+        m_conflate = rhs.m_conflate;
+        m_invoker = rhs.m_invoker;
         BaseType::Assign(rhs);
     }
     /// @brief Creates a copy of the current object.
@@ -1015,6 +1785,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -1034,6 +1823,10 @@ public:
             BaseType::operator=(std::move(rhs));
             m_thread = rhs.m_thread;    // Use the resource
             m_priority = rhs.m_priority;
+            m_lifetime = rhs.m_lifetime;
+            m_inlineSameThread = rhs.m_inlineSameThread;
+            m_conflate = rhs.m_conflate;
+            m_invoker = std::move(rhs.m_invoker);
             rhs.Clear();
         }
         return *this;
@@ -1089,9 +1882,10 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
+    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into the message. 
     /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// library performs all necessary argument coping for the caller. By value and rvalue
+    /// reference arguments are moved instead of copied. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -1102,28 +1896,62 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
+        // Caller already executing on the destination thread invokes directly, if enabled
+        if (m_inlineSameThread && m_thread && m_thread->IsCurrentThread())
             return BaseType::operator()(std::forward<Args>(args)...);
-        }
-        else {
-            // Create a clone instance of this delegate 
-            auto delegate = std::shared_ptr<ClassType>(Clone());
-            if (!delegate)
+
+        // Shared invoker is created by the first call, so a temporary delegate that is
+        // never called (e.g. passed to `operator-=`) allocates nothing
+        auto& invoker = GetInvoker();
+
+        if (m_conflate) {
+            // Store the latest arguments. Message has no invoker; it only holds arguments.
+            auto argMsg = MakeMsg<DelegateAsyncMsg<Args...>>(nullptr, m_priority, std::forward<Args>(args)...);
+            if (!argMsg)
                 BAD_ALLOC();
 
-            // Create a new message instance for sending to the destination thread
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncMsg<Args...>> msg(new DelegateAsyncMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            MsgPtr<DelegateConflateMsg<Args...>> msg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                m_conflate->latest = std::move(argMsg);
+
+                // A queued message will invoke the target with the latest arguments
+                if (m_conflate->queued)
+                    return RetType();
+
+                // Queued message carries no arguments. Invoke() uses the slot arguments.
+                msg = MakeMsg<DelegateConflateMsg<Args...>>(invoker, m_priority, m_conflate);
+                if (!msg)
+                    BAD_ALLOC();
+                m_conflate->queued = msg.get();
+            }
+
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+            // Dispatch outside the slot lock. A discarded message locks the slot.
+            auto thread = this->GetThread();
+            if (thread)
+                thread->DispatchDelegate(std::move(msg));
+            return RetType();
+        }
+        else {
+            // Create a new message instance for sending to the destination thread. All 
+            // messages share the same immutable invoker instance.
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncMsg<Args...>>(invoker, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
 
+            // Message expires if not invoked within the lifetime
+            if (m_lifetime.has_value())
+                msg->SetDeadline(Clock::now() + m_lifetime.value());
+
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destintation thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(std::move(msg));
             }
 
             // Do not wait for destination thread return value from async function call
@@ -1147,26 +1975,87 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Invoke delegate function asynchronously and return a future for the 
+    /// return value. Called by the source thread. Does not wait for the target function.
+    /// @details Unlike `DelegateAsyncWait`, the source thread is not blocked. Use the
+    /// future to wait for, poll or chain a continuation on the return value. Several 
+    /// futures may be outstanding at once; see `WhenAll()`. Conflation does not apply; 
+    /// each call dispatches a message.
+    /// @param[in] args The function arguments, if any.
+    /// @return The future. Not valid if the delegate is empty or has no thread.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    Future<RetType> AsyncInvokeFuture(Args... args) {
+        auto thread = this->GetThread();
+        if (this->Empty() || !thread)
+            return Future<RetType>();
+
+        auto& invoker = GetInvoker();
+
+        // Message holds the arguments and the future state
+        auto msg = MakeMsg<DelegateFutureMsg<RetType, Args...>>(invoker, m_priority, std::forward<Args>(args)...);
+        if (!msg)
+            BAD_ALLOC();
+
+        if (m_lifetime.has_value())
+            msg->SetDeadline(Clock::now() + m_lifetime.value());
+
+        Future<RetType> future(msg.Share());
+
+        // Caller executing on the destination thread invokes directly. A queued call 
+        // could never complete while the caller waits on the future.
+        if (thread->IsCurrentThread())
+            invoker->Invoke(*msg);
+        else
+            thread->DispatchDelegate(std::move(msg));
+        return future;
+    }
+
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destintation thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. Unlike `DelegateAsyncWait`, a lock is not required between 
+    /// on the destination thread. Called on the shared invoker instance, which is not 
+    /// modified. Unlike `DelegateAsyncWait`, a lock is not required between 
     /// source and destination `delegateMsg` access because the source thread is not waiting 
     /// for the function call to complete.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncMsg<Args...>>(msg);
+    virtual bool Invoke(DelegateMsg& msg) override {
+        // Future message stores the return value for the waiting source thread
+        if (auto futureMsg = MsgCast<DelegateFutureMsg<RetType, Args...>>(msg)) {
+            auto call = [this](auto&&... args) -> RetType { return this->BaseType::operator()(std::forward<decltype(args)>(args)...); };
+            if constexpr (std::is_void_v<RetType>) {
+                futureMsg->Apply(call);
+                futureMsg->SetValue(true);
+            }
+            else {
+                futureMsg->SetValue(futureMsg->Apply(call));
+            }
+            return true;
+        }
+
+        // Conflating delegate invokes the latest arguments stored in the slot
+        if (m_conflate) {
+            MsgPtr<DelegateAsyncMsg<Args...>> argMsg;
+            {
+                std::lock_guard<std::mutex> lock(m_conflate->lock);
+                argMsg = std::move(m_conflate->latest);
+                m_conflate->queued = nullptr;
+            }
+            if (!argMsg)
+                return true;
+
+            argMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
+            return true;
+        }
+
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
-
-        // Invoke the target function using the source thread supplied function arguments
-        std::apply(&BaseType::operator(),
-            std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
+        // Invoke the target function synchronously using the source thread supplied 
+        // function arguments. The qualified call bypasses the virtual async operator().
+        delegateMsg->Apply([this](auto&&... args) { this->BaseType::operator()(std::forward<decltype(args)>(args)...); });
         return true;
     }
 
@@ -1179,16 +2068,117 @@ public:
     Priority GetPriority() const noexcept { return m_priority; }
     void SetPriority(Priority priority) noexcept { m_priority = priority; }
 
+    /// @brief Get the delegate message lifetime
+    /// @return The message lifetime, or std::nullopt if messages never expire.
+    std::optional<Duration> GetLifetime() const noexcept { return m_lifetime; }
+
+    /// @brief Set the delegate message lifetime. Each message dispatched by `operator()` 
+    /// is given a deadline of now plus `lifetime`. The destination thread invokes messages 
+    /// of equal priority earliest deadline first and discards messages not invoked before 
+    /// their deadline. The lifetime is not used by `Equal()`.
+    /// @param[in] lifetime The message lifetime, or std::nullopt to never expire.
+    void SetLifetime(std::optional<Duration> lifetime) noexcept { m_lifetime = lifetime; }
+
+    /// @brief Get the same thread inline mode
+    /// @return `true` if calls made on the destination thread are invoked synchronously.
+    bool GetInlineSameThread() const noexcept { return m_inlineSameThread; }
+
+    /// @brief Invoke the target function synchronously, without queuing a message, when 
+    /// `operator()` is called from the destination thread. Disabled by default since an 
+    /// inline call runs ahead of messages already queued to the thread. The mode is not 
+    /// used by `Equal()`.
+    /// @param[in] inlineSameThread `true` to enable.
+    void SetInlineSameThread(bool inlineSameThread) noexcept { m_inlineSameThread = inlineSameThread; }
+
+    /// @brief Get the conflation mode
+    /// @return `true` if conflation is enabled.
+    bool GetConflate() const noexcept { return m_conflate != nullptr; }
+
+    /// @brief Enable or disable conflation ("latest value wins"). When enabled, a call 
+    /// made while a previous call is still queued on the destination thread replaces 
+    /// the queued arguments instead of queuing another message. Copies of this delegate 
+    /// made after enabling share the same pending message. The mode is not used by `Equal()`.
+    /// @param[in] conflate `true` to enable conflation.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void SetConflate(bool conflate) {
+        if (conflate == GetConflate())
+            return;
+        if (!conflate)
+            m_conflate = nullptr;
+        else {
+            m_conflate = std::shared_ptr<DelegateConflateSlot<Args...>>(new(std::nothrow) DelegateConflateSlot<Args...>());
+            if (!m_conflate)
+                BAD_ALLOC();
+        }
+
+        // Invoker must share the new conflation state; created by the next call
+        m_invoker = nullptr;
+    }
+
+    /// @brief Get the destination thread used for broadcast fusion. See 
+    /// `Delegate::GetFusionThread()`. Conflating, expiring and same thread inline 
+    /// calls are not fused.
+    /// @param[out] priority The message priority.
+    /// @return The destination thread, or nullptr if the call is not fusable.
+    virtual IThread* GetFusionThread(Priority& priority) const override {
+        if (this->Empty() || !m_thread || m_conflate || m_lifetime.has_value())
+            return nullptr;
+        if (m_inlineSameThread && m_thread->IsCurrentThread())
+            return nullptr;
+        priority = m_priority;
+        return m_thread;
+    }
+
+    /// @brief Get the shared invoker instance. See `Delegate::GetFusionInvoker()`.
+    /// @return The immutable copy of this delegate shared by all dispatched messages.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    virtual std::shared_ptr<Delegate<RetType(Args...)>> GetFusionInvoker() const override {
+        return GetInvoker();
+    }
+
+    /// @brief Invoke the target function synchronously. Called by the destination 
+    /// thread on the shared invoker instance when a fused broadcast message is received.
+    /// @param[in] args The function arguments, if any.
+    /// @return The target function return value.
+    virtual RetType InvokeTarget(Args... args) override {
+        return BaseType::operator()(std::forward<Args>(args)...);
+    }
+
 private:
+    /// @brief Get the shared invoker instance sent with each message. Created on first 
+    /// use. Like the other delegate members, not safe to call from several threads at 
+    /// once on the same delegate instance; use a thread-safe container to share one.
+    /// @return The shared invoker instance.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    const std::shared_ptr<ClassType>& GetInvoker() const {
+        if (!m_invoker) {
+            // The clone is created with no invoker of its own
+            m_invoker = std::shared_ptr<ClassType>(Clone());
+            if (!m_invoker)
+                BAD_ALLOC();
+        }
+        return m_invoker;
+    }
+
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
 
+    /// The delegate message lifetime
+    std::optional<Duration> m_lifetime;
+
+    /// Invoke synchronously when called from the destination thread
+    bool m_inlineSameThread = false;
+
+    /// The conflation state shared with copies, or nullptr if not conflating
+    std::shared_ptr<DelegateConflateSlot<Args...>> m_conflate;
+
+    /// The immutable copy of this delegate shared by all dispatched messages, or 
+    /// nullptr until first used
+    mutable std::shared_ptr<ClassType> m_invoker;
+
     // </common_code>
 };
 
@@ -23,7 +23,12 @@
 /// waiting for the destination thread to complete the function invoke. If the caller timeout expires, 
 /// the target function is not invoked. 
 /// 
-/// The `m_lock` mutex is used to protect shared state data between the source and destination 
+/// The timeout bounds the wait for the target function to start, not to complete. If the 
+/// timeout expires while the target function is executing, the source thread waits without 
+/// a timeout for it to return, since the arguments may reference caller data. The call then 
+/// succeeds. Avoid long running target functions if the caller must not block indefinitely.
+/// 
+/// An atomic handshake state within the message coordinates the source and destination 
 /// threads using the two thread-safe functions below:
 ///
 /// `RetType operator()(Args... args)` - called by the source thread to initiate the async
@@ -31,7 +36,7 @@
 /// is not defined. Clone() also may throw `std::bad_alloc` unless 'DMQ_ASSERTS'. All other delegate 
 /// class functions do not throw exceptions.
 ///
-/// `void Invoke(std::shared_ptr<DelegateMsg> msg)` - called by the destination
+/// `bool Invoke(DelegateMsg& msg)` - called by the destination
 /// thread to invoke the target function. The destination thread must not call any other
 /// delegate instance functions.
 /// 
@@ -57,6 +62,8 @@
 #include "Delegate.h"
 #include "IThread.h"
 #include "IInvoker.h"
+#include "MsgPool.h"
+#include <atomic>
 #include <optional>
 #include <any>
 #include <chrono>
@@ -77,7 +84,8 @@ public:
     /// @param[in] invoker - the invoker instance
     /// @param[in] priority - the delegate message priority
     /// @param[in] args - a parameter pack of all target function arguments
-    DelegateAsyncWaitMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : DelegateMsg(invoker, priority),
+    DelegateAsyncWaitMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : 
+        DelegateMsg(std::move(invoker), priority, TypeIdOf<DelegateAsyncWaitMsg>()),
         m_args(std::forward<Args>(args)...) {}
 
     /// Delete the default constructor
@@ -104,24 +112,34 @@ public:
     /// @return The semaphore reference.
     Semaphore& GetSema() { return m_sema; }
 
-    /// Get a mutex shared between sender and receiver threads.
-    /// @return The lock reference.
-    std::mutex& GetLock() { return m_lock; }
+    /// Claim the message for invoking the target function. Called by the destination thread.
+    /// @return `true` if the source thread is waiting and the target function must be 
+    /// invoked, followed by `EndInvoke()`. `false` if the source thread timed out.
+    bool BeginInvoke() {
+        State expected = State::WAITING;
+        return m_state.compare_exchange_strong(expected, State::INVOKING, std::memory_order_acquire);
+    }
 
-    /// True if the sending thread is waiting for the receiver thread to call the function.
-    /// False if the sending thread delegate timeout occurred and is not waiting.
-    /// @return `true` if the sending thread is waiting for the receiving thread to complete
-    /// the target function invoke.
-    bool GetInvokerWaiting() { return m_invokerWaiting; }
+    /// Publish the target function results and release the source thread. Called by 
+    /// the destination thread.
+    void EndInvoke() {
+        m_state.store(State::DONE, std::memory_order_release);
+        m_sema.Signal();
+    }
 
-    /// Set to true when source thread is waiting for destination thread to complete the 
-    /// function call.
-    /// @param[in] invokerWaiting The status of the invoker waiting flag.
-    void SetInvokerWaiting(bool invokerWaiting) { m_invokerWaiting = invokerWaiting; }
+    /// Withdraw the call after a timeout. Called by the source thread.
+    /// @return `true` if the target function will not be invoked. `false` if the 
+    /// destination thread already claimed the message; wait on the semaphore for 
+    /// `EndInvoke()` before accessing the arguments or results. The wait is unbounded 
+    /// since the target function is executing.
+    bool Abandon() {
+        State expected = State::WAITING;
+        return m_state.compare_exchange_strong(expected, State::ABANDONED, std::memory_order_acquire);
+    }
 
 private:
-    /// An empty starting tuple
-    std::tuple<> m_start;
+    /// Source and destination thread handshake states
+    enum class State { WAITING, INVOKING, DONE, ABANDONED };
 
     /// A tuple with each function argument element 
     std::tuple<Args...> m_args;
@@ -129,11 +147,8 @@ private:
     /// Semaphore to signal waiting thread
     Semaphore m_sema;
 
-    /// Lock to protect shared data 
-    std::mutex m_lock;                       
-
-    /// True if source thread is waiting for destination thread invoke to complete
-    bool m_invokerWaiting = false;
+    /// Handshake state. Replaces a lock between the source and destination threads.
+    std::atomic<State> m_state = State::WAITING;
 };
 
 template <class R>
@@ -172,7 +187,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFreeAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_success(rhs.m_success), m_timeout(rhs.m_timeout), m_retVal(rhs.m_retVal), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -217,6 +232,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -304,8 +338,8 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicate and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The message handshake state 
+    /// ensures the source thread returns only after the destination thread stops using the data.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
@@ -315,6 +349,20 @@ public:
         if (this->Empty())
             return RetType();
 
+        // Caller executing on the destination thread invokes directly. Dispatching 
+        // would block until timeout since the thread cannot process its own queue.
+        if (m_thread && m_thread->IsCurrentThread()) {
+            m_success = true;
+            if constexpr (std::is_void<RetType>::value == true) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return;
+            } else {
+                RetType retVal = BaseType::operator()(std::forward<Args>(args)...);
+                m_retVal = retVal;
+                return retVal;
+            }
+        }
+
         // Synchronously invoke the target function?
         if (m_sync) {
             // Invoke the target function directly
@@ -326,33 +374,33 @@ public:
                 BAD_ALLOC();
 
             // Create a new message instance for sending to the destination thread.
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncWaitMsg<Args...>> msg(new DelegateAsyncWaitMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
 
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(msg.Share());
 
                 // Wait for destination thread to execute the delegate function and get return value
                 if (msg->GetSema().Wait(m_timeout)) {
-                    // Wait succeeded. Now acquire lock to safely read the value.
-                    const std::lock_guard<std::mutex> lock(msg->GetLock());
+                    // EndInvoke() published the return value
+                    m_success = true;
+                    m_retVal = delegate->m_retVal;
+                }
+                else if (!msg->Abandon()) {
+                    // Timeout expired while the target function is executing. Arguments 
+                    // may reference caller data, so wait without a timeout for the invoke 
+                    // to complete. The call completed, so publish the result.
+                    msg->GetSema().Wait(WAIT_INFINITE);
                     m_success = true;
                     m_retVal = delegate->m_retVal;
                 }
             }
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
             // Does the target function have a return value?
             if constexpr (std::is_void<RetType>::value == false) {
                 // Is the return value valid? 
@@ -386,27 +434,24 @@ public:
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The message handshake state claims the call so only one of
+    /// invoke or source timeout wins. A semaphore is used to signal the source thread when the 
+    /// destination thread completes the target function call.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+    virtual bool Invoke(DelegateMsg& msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncWaitMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
         // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        if (delegateMsg->BeginInvoke()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -421,7 +466,7 @@ public:
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->EndInvoke();
         }
         return true;
     }
@@ -547,7 +592,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateMemberAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_success(rhs.m_success), m_timeout(rhs.m_timeout), m_retVal(rhs.m_retVal), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -638,6 +683,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -725,8 +789,8 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicate and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The message handshake state 
+    /// ensures the source thread returns only after the destination thread stops using the data.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
@@ -736,6 +800,20 @@ public:
         if (this->Empty())
             return RetType();
 
+        // Caller executing on the destination thread invokes directly. Dispatching 
+        // would block until timeout since the thread cannot process its own queue.
+        if (m_thread && m_thread->IsCurrentThread()) {
+            m_success = true;
+            if constexpr (std::is_void<RetType>::value == true) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return;
+            } else {
+                RetType retVal = BaseType::operator()(std::forward<Args>(args)...);
+                m_retVal = retVal;
+                return retVal;
+            }
+        }
+
         // Synchronously invoke the target function?
         if (m_sync) {
             // Invoke the target function directly
@@ -747,33 +825,33 @@ public:
                 BAD_ALLOC();
 
             // Create a new message instance for sending to the destination thread.
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncWaitMsg<Args...>> msg(new DelegateAsyncWaitMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
 
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(msg.Share());
 
                 // Wait for destination thread to execute the delegate function and get return value
                 if (msg->GetSema().Wait(m_timeout)) {
-                    // Wait succeeded. Now acquire lock to safely read the value.
-                    const std::lock_guard<std::mutex> lock(msg->GetLock());
+                    // EndInvoke() published the return value
+                    m_success = true;
+                    m_retVal = delegate->m_retVal;
+                }
+                else if (!msg->Abandon()) {
+                    // Timeout expired while the target function is executing. Arguments 
+                    // may reference caller data, so wait without a timeout for the invoke 
+                    // to complete. The call completed, so publish the result.
+                    msg->GetSema().Wait(WAIT_INFINITE);
                     m_success = true;
                     m_retVal = delegate->m_retVal;
                 }
             }
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
             // Does the target function have a return value?
             if constexpr (std::is_void<RetType>::value == false) {
                 // Is the return value valid? 
@@ -807,27 +885,24 @@ public:
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The message handshake state claims the call so only one of
+    /// invoke or source timeout wins. A semaphore is used to signal the source thread when the 
+    /// destination thread completes the target function call.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+    virtual bool Invoke(DelegateMsg& msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncWaitMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
         // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        if (delegateMsg->BeginInvoke()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -842,7 +917,7 @@ public:
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->EndInvoke();
         }
         return true;
     }
@@ -931,7 +1006,7 @@ public:
 
     /// @brief Move constructor
     DelegateMemberAsyncWaitSp(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_success(rhs.m_success), m_timeout(rhs.m_timeout), m_retVal(rhs.m_retVal), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -976,6 +1051,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -1063,8 +1157,8 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicate and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The message handshake state 
+    /// ensures the source thread returns only after the destination thread stops using the data.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
@@ -1074,6 +1168,20 @@ public:
         if (this->Empty())
             return RetType();
 
+        // Caller executing on the destination thread invokes directly. Dispatching 
+        // would block until timeout since the thread cannot process its own queue.
+        if (m_thread && m_thread->IsCurrentThread()) {
+            m_success = true;
+            if constexpr (std::is_void<RetType>::value == true) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return;
+            } else {
+                RetType retVal = BaseType::operator()(std::forward<Args>(args)...);
+                m_retVal = retVal;
+                return retVal;
+            }
+        }
+
         // Synchronously invoke the target function?
         if (m_sync) {
             // Invoke the target function directly
@@ -1085,33 +1193,33 @@ public:
                 BAD_ALLOC();
 
             // Create a new message instance for sending to the destination thread.
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncWaitMsg<Args...>> msg(new DelegateAsyncWaitMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
 
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(msg.Share());
 
                 // Wait for destination thread to execute the delegate function and get return value
                 if (msg->GetSema().Wait(m_timeout)) {
-                    // Wait succeeded. Now acquire lock to safely read the value.
-                    const std::lock_guard<std::mutex> lock(msg->GetLock());
+                    // EndInvoke() published the return value
+                    m_success = true;
+                    m_retVal = delegate->m_retVal;
+                }
+                else if (!msg->Abandon()) {
+                    // Timeout expired while the target function is executing. Arguments 
+                    // may reference caller data, so wait without a timeout for the invoke 
+                    // to complete. The call completed, so publish the result.
+                    msg->GetSema().Wait(WAIT_INFINITE);
                     m_success = true;
                     m_retVal = delegate->m_retVal;
                 }
             }
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
             // Does the target function have a return value?
             if constexpr (std::is_void<RetType>::value == false) {
                 // Is the return value valid? 
@@ -1145,27 +1253,24 @@ public:
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The message handshake state claims the call so only one of
+    /// invoke or source timeout wins. A semaphore is used to signal the source thread when the 
+    /// destination thread completes the target function call.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+    virtual bool Invoke(DelegateMsg& msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncWaitMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
         // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        if (delegateMsg->BeginInvoke()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -1180,7 +1285,7 @@ public:
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->EndInvoke();
         }
         return true;
     }
@@ -1271,7 +1376,7 @@ public:
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
     DelegateFunctionAsyncWait(ClassType&& rhs) noexcept :
-        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_priority(rhs.m_priority), m_timeout(rhs.m_timeout), m_success(rhs.m_success), m_retVal(rhs.m_retVal) {
+        BaseType(std::move(rhs)), m_thread(rhs.m_thread), m_success(rhs.m_success), m_timeout(rhs.m_timeout), m_retVal(rhs.m_retVal), m_priority(rhs.m_priority) {
         rhs.Clear();
     }
 
@@ -1316,6 +1421,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -1403,8 +1527,8 @@ public:
     /// 
     /// The `DelegateAsyncWaitMsg` does not duplicate and copy the function arguments into heap
     /// memory. The source thread waits on the destintation thread to complete, therefore argument
-    /// data is shared between the source and destination threads and simultaneous access is prevented
-    /// using a mutex.
+    /// data is shared between the source and destination threads. The message handshake state 
+    /// ensures the source thread returns only after the destination thread stops using the data.
     /// @param[in] args The function arguments, if any.
     /// @return The bound function return value, if any. Use `IsSuccess()` to determine if 
     /// the return value is valid before use.
@@ -1414,6 +1538,20 @@ public:
         if (this->Empty())
             return RetType();
 
+        // Caller executing on the destination thread invokes directly. Dispatching 
+        // would block until timeout since the thread cannot process its own queue.
+        if (m_thread && m_thread->IsCurrentThread()) {
+            m_success = true;
+            if constexpr (std::is_void<RetType>::value == true) {
+                BaseType::operator()(std::forward<Args>(args)...);
+                return;
+            } else {
+                RetType retVal = BaseType::operator()(std::forward<Args>(args)...);
+                m_retVal = retVal;
+                return retVal;
+            }
+        }
+
         // Synchronously invoke the target function?
         if (m_sync) {
             // Invoke the target function directly
@@ -1425,33 +1563,33 @@ public:
                 BAD_ALLOC();
 
             // Create a new message instance for sending to the destination thread.
-            // If using XALLOCATOR explicit operator new required. See xallocator.h.
-            std::shared_ptr<DelegateAsyncWaitMsg<Args...>> msg(new DelegateAsyncWaitMsg<Args...>(delegate, m_priority, std::forward<Args>(args)...));
+            // Message and control block are allocated together from the message pool.
+            auto msg = MakeMsg<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
 
             auto thread = this->GetThread();
             if (thread) {
                 // Dispatch message onto the callback destination thread. Invoke()
                 // will be called by the destination thread. 
-                thread->DispatchDelegate(msg);
+                thread->DispatchDelegate(msg.Share());
 
                 // Wait for destination thread to execute the delegate function and get return value
                 if (msg->GetSema().Wait(m_timeout)) {
-                    // Wait succeeded. Now acquire lock to safely read the value.
-                    const std::lock_guard<std::mutex> lock(msg->GetLock());
+                    // EndInvoke() published the return value
+                    m_success = true;
+                    m_retVal = delegate->m_retVal;
+                }
+                else if (!msg->Abandon()) {
+                    // Timeout expired while the target function is executing. Arguments 
+                    // may reference caller data, so wait without a timeout for the invoke 
+                    // to complete. The call completed, so publish the result.
+                    msg->GetSema().Wait(WAIT_INFINITE);
                     m_success = true;
                     m_retVal = delegate->m_retVal;
                 }
             }
 
-            // Protect data shared between source and destination threads
-            const std::lock_guard<std::mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
             // Does the target function have a return value?
             if constexpr (std::is_void<RetType>::value == false) {
                 // Is the return value valid? 
@@ -1485,27 +1623,24 @@ public:
     /// @brief Invoke the delegate function on the destination thread. Called by the 
     /// destination thread.
     /// @details Each source thread call to `operator()` generate a call to `Invoke()` 
-    /// on the destination thread. A lock is used to protect source and destination thread shared 
-    /// data. A semaphore is used to signal the source thread when the destination thread 
-    /// completes the target function call.
+    /// on the destination thread. The message handshake state claims the call so only one of
+    /// invoke or source timeout wins. A semaphore is used to signal the source thread when the 
+    /// destination thread completes the target function call.
     /// 
     /// If source thread timeout expires and before the destination thread invokes the 
     /// target function, the target function is not called.
     /// @param[in] msg The delegate message created and sent within `operator()(Args... args)`.
     /// @return `true` if target function invoked or timeout expired; `false` if error. 
-    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+    virtual bool Invoke(DelegateMsg& msg) override {
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
-        // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        // Recover the derived message type. A type identifier compare; no RTTI.
+        auto delegateMsg = MsgCast<DelegateAsyncWaitMsg<Args...>>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const std::lock_guard<std::mutex> lock(delegateMsg->GetLock());
-
         // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
+        if (delegateMsg->BeginInvoke()) {
             // Invoke the delegate function synchronously
             m_sync = true;
 
@@ -1520,7 +1655,7 @@ public:
             }
 
             // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
+            delegateMsg->EndInvoke();
         }
         return true;
     }
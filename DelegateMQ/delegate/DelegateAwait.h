@@ -0,0 +1,179 @@
+#ifndef _DELEGATE_AWAIT_H
+#define _DELEGATE_AWAIT_H
+
+/// @file
+/// @brief C++20 coroutine support for asynchronous delegates.
+///
+/// @details `co_await dmq::Await(delegate, args...)` invokes the target function on the
+/// delegate destination thread and suspends the calling coroutine without blocking the
+/// calling thread. When the target function completes, the coroutine resumes on the
+/// originating delegate thread (see `IThread::GetCurrent()`) with the return value. If
+/// the coroutine was not running on a delegate thread, it resumes on the destination
+/// thread instead.
+///
+/// @code
+/// dmq::Task Run()
+/// {
+///     auto delegate = dmq::MakeDelegate(&obj, &Class::Func, workerThread);
+///     std::optional<int> value = co_await dmq::Await(delegate, 123);
+/// }
+/// @endcode
+///
+/// The awaited result is the same as `Future<>::Get()`: `std::optional<RetType>`, or `bool`
+/// for a `void` return type. The result is empty if the delegate is empty or has no thread.
+/// A coroutine never resumes if the destination thread discards the message (e.g. the
+/// message lifetime expired or the thread exited).
+///
+/// Available only if the compiler supports coroutines (C++20). Otherwise this header
+/// is empty.
+
+#include "DelegateAsync.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+
+namespace dmq {
+
+/// @brief Message that resumes a suspended coroutine on the destination thread.
+class CoroutineResumeMsg : public DelegateMsg
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the resume invoker instance
+    /// @param[in] handle - the coroutine to resume
+    CoroutineResumeMsg(std::shared_ptr<IThreadInvoker> invoker, std::coroutine_handle<> handle) :
+        DelegateMsg(std::move(invoker), Priority::NORMAL, TypeIdOf<CoroutineResumeMsg>()),
+        m_handle(handle) {}
+
+    std::coroutine_handle<> GetHandle() const noexcept { return m_handle; }
+
+private:
+    std::coroutine_handle<> m_handle;
+};
+
+/// @brief Invoker shared by all coroutine resume messages
+class CoroutineResumer : public IThreadInvoker
+{
+public:
+    /// Get the shared instance using the "Immortal" Pattern. Resume messages may
+    /// be destroyed after static destructors run.
+    static const std::shared_ptr<IThreadInvoker>& GetInstance() {
+        static auto* instance = new std::shared_ptr<IThreadInvoker>(new CoroutineResumer());
+        return *instance;
+    }
+
+    /// Resume the coroutine. Called by the destination thread.
+    virtual bool Invoke(DelegateMsg& msg) override {
+        auto resumeMsg = MsgCast<CoroutineResumeMsg>(msg);
+        if (resumeMsg == nullptr)
+            return false;
+        resumeMsg->GetHandle().resume();
+        return true;
+    }
+};
+
+/// @brief Awaiter returned by `Await()`.
+/// @tparam RetType The return type of the bound delegate function.
+template <class RetType>
+class DelegateAwaiter
+{
+public:
+    using ValueType = typename FutureState<RetType>::ValueType;
+
+    /// Constructor
+    /// @param[in] future - the future of the dispatched call.
+    explicit DelegateAwaiter(Future<RetType> future) : m_future(std::move(future)) {}
+
+    DelegateAwaiter(const DelegateAwaiter&) = delete;
+    DelegateAwaiter& operator=(const DelegateAwaiter&) = delete;
+
+    /// Do not suspend if the call could not be dispatched
+    bool await_ready() const noexcept { return !m_future.IsValid(); }
+
+    /// Suspend the coroutine until the target function completes
+    /// @param[in] handle - the awaiting coroutine.
+    /// @return `false` to continue without suspending if the call already completed.
+    bool await_suspend(std::coroutine_handle<> handle) {
+        IThread* origin = IThread::GetCurrent();
+
+        auto resume = [this, origin, handle]() {
+            if (origin) {
+                // Queue the resume onto the originating thread
+                auto msg = MakeMsg<CoroutineResumeMsg>(CoroutineResumer::GetInstance(), handle);
+                origin->DispatchDelegate(std::move(msg));
+            }
+            else if (m_done.exchange(true)) {
+                // await_suspend() has returned; resume on the destination thread
+                handle.resume();
+            }
+        };
+
+        if constexpr (std::is_void_v<RetType>) {
+            m_future.Then([this, resume]() {
+                m_value.emplace(true);
+                resume();
+            });
+        }
+        else {
+            m_future.Then([this, resume](ValueType& value) {
+                m_value.emplace(std::move(value));
+                resume();
+            });
+        }
+
+        // Origin thread resume is always queued. Otherwise suspend unless the
+        // continuation already ran.
+        return origin ? true : !m_done.exchange(true);
+    }
+
+    /// Get the call result
+    /// @return The return value, or `std::nullopt` if not dispatched. `bool`
+    /// completion status for a `void` return type.
+    auto await_resume() {
+        if constexpr (std::is_void_v<RetType>)
+            return m_value.has_value();
+        else
+            return m_value.has_value() ? std::optional<RetType>(std::move(*m_value)) : std::optional<RetType>();
+    }
+
+private:
+    Future<RetType> m_future;
+    std::optional<ValueType> m_value;
+    std::atomic<bool> m_done = false;
+};
+
+/// Invoke an async delegate target function and await the result without blocking.
+/// @param[in] delegate - an async delegate (e.g. `DelegateMemberAsync`).
+/// @param[in] args - the function arguments, if any.
+/// @return The awaiter. Use with `co_await`.
+/// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+template <class Delegate, class... Args>
+auto Await(Delegate& delegate, Args&&... args)
+{
+    auto future = delegate.AsyncInvokeFuture(std::forward<Args>(args)...);
+    return DelegateAwaiter<typename decltype(future)::ReturnType>(std::move(future));
+}
+
+/// @brief Minimal eagerly started coroutine type for code that awaits delegates.
+/// @details The coroutine starts when called and its frame is destroyed when it
+/// completes. The caller cannot wait on the result. An unhandled exception terminates.
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+}
+
+#endif
+
+#endif
@@ -3,16 +3,29 @@
 
 /// @file
 /// @brief Delegate inter-thread message base class. 
+///
+/// @details Messages are intrusively reference counted and owned through the move-only
+/// `MsgPtr<>` handle. Moving a handle from the source thread into the destination 
+/// thread queue and on to `IThreadInvoker::Invoke()` costs no atomic operations. Call 
+/// `MsgPtr::Share()` only when a second owner is required (e.g. a waiting source thread).
+/// Create messages using `MakeMsg<>()`.
+///
+/// Each message records a compile-time type identifier. `MsgCast<>()` recovers the derived
+/// message type using a single pointer comparison instead of RTTI.
 
 #include "IInvoker.h"
 #include "DelegateOpt.h"
 #include "Semaphore.h"
 #include "make_tuple_heap.h"
+#include "MsgPool.h"
+#include <atomic>
 #include <tuple>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <typeinfo>
 
 namespace dmq {
 
@@ -24,26 +37,63 @@ enum class Priority
 	HIGH
 };
 
+class DelegateMsg;
+template <class T> class MsgPtr;
+template <class T, class... Args> MsgPtr<T> MakeMsg(Args&&... args);
+
 /// @brief Base class for all delegate inter-thread messages
 class DelegateMsg
 {
 public:
 	/// Constructor
 	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	DelegateMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority) :
-		m_priority(priority), m_invoker(invoker)
+	/// @param[in] priority - the delegate message priority.
+	/// @param[in] typeId - the derived message type identifier. See `GetTypeId()`.
+	DelegateMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, const void* typeId = nullptr) :
+		m_invoker(std::move(invoker)), m_priority(priority), m_typeId(typeId)
 	{
 	}
 
 	virtual ~DelegateMsg() = default;
 
 	/// Get the delegate invoker instance the delegate is registered with.
-	/// @return The invoker instance. 
-	std::shared_ptr<IThreadInvoker> GetInvoker() const { return m_invoker; }
+	/// @return The invoker instance. Valid for the message lifetime.
+	IThreadInvoker* GetInvoker() const { return m_invoker.get(); }
 
 	/// Get the delegate message priority
 	/// @return Delegate message priority
-	Priority GetPriority() { return m_priority; }
+	Priority GetPriority() const { return m_priority; }
+
+	/// Get the time after which the message is stale and should not be invoked
+	/// @return The deadline, or std::nullopt if the message never expires.
+	std::optional<Clock::time_point> GetDeadline() const { return m_deadline; }
+
+	/// Set the time after which the message is stale and should not be invoked
+	/// @param[in] deadline - the deadline, or std::nullopt to never expire.
+	void SetDeadline(std::optional<Clock::time_point> deadline) { m_deadline = deadline; }
+
+	/// Check if the message deadline has passed
+	/// @param[in] now - the current time
+	/// @return `true` if the message is expired.
+	bool IsExpired(Clock::time_point now) const { return m_deadline.has_value() && now > m_deadline.value(); }
+
+	/// Get the type of the target invoked by the message. Used for diagnostics.
+	/// @return The invoker type. A message invoking several targets returns the type
+	/// of the first target.
+	virtual const std::type_info& GetTargetType() const { return typeid(*m_invoker); }
+
+	/// Get the derived message type identifier
+	/// @return The identifier passed to the constructor.
+	const void* GetTypeId() const noexcept { return m_typeId; }
+
+	/// Get a unique identifier for a message type without RTTI
+	/// @tparam T The message type.
+	/// @return The address of a per-type static object.
+	template <class T>
+	static const void* TypeIdOf() noexcept {
+		static const char id = 0;
+		return &id;
+	}
 
 private:
 	/// The IThreadInvoker instance used to invoke the target function 
@@ -53,10 +103,137 @@ private:
 	/// The delegate message priority
 	Priority m_priority = Priority::NORMAL;
 
-	// Use fixed-block memory allocator if DMQ_ALLOCATOR set
-	XALLOCATOR
+	/// The optional delegate message deadline
+	std::optional<Clock::time_point> m_deadline;
+
+	/// The derived message type identifier
+	const void* m_typeId = nullptr;
+
+	/// The pooled memory block holding the most derived object
+	void* m_block = nullptr;
+
+	/// Number of MsgPtr handles owning the message
+	std::atomic<uint32_t> m_refCount = 1;
+
+	template <class T> friend class MsgPtr;
+	template <class T, class... Args> friend MsgPtr<T> MakeMsg(Args&&... args);
+
+	/// Add an owner
+	void AddRef() noexcept { m_refCount.fetch_add(1, std::memory_order_relaxed); }
+
+	/// Remove an owner and destroy the message when none remain
+	void Release() noexcept {
+		if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			void* mem = m_block;
+			this->~DelegateMsg();
+			MsgPool::Deallocate(mem);
+		}
+	}
 };
 
+/// @brief Move-only owning handle to a reference counted delegate message.
+/// @tparam T The message type.
+template <class T>
+class MsgPtr
+{
+public:
+	MsgPtr() noexcept = default;
+	MsgPtr(std::nullptr_t) noexcept {}
+
+	/// Adopt a message reference. Used by `MakeMsg()`.
+	/// @param[in] msg - the message. The caller reference is transferred to the handle.
+	explicit MsgPtr(T* msg) noexcept : m_msg(msg) {}
+
+	MsgPtr(MsgPtr&& rhs) noexcept : m_msg(rhs.release()) {}
+
+	/// Move from a handle to a derived message type
+	template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+	MsgPtr(MsgPtr<U>&& rhs) noexcept : m_msg(rhs.release()) {}
+
+	MsgPtr& operator=(MsgPtr&& rhs) noexcept {
+		if (&rhs != this) {
+			reset();
+			m_msg = rhs.release();
+		}
+		return *this;
+	}
+
+	MsgPtr(const MsgPtr&) = delete;
+	MsgPtr& operator=(const MsgPtr&) = delete;
+
+	~MsgPtr() { reset(); }
+
+	/// Create another owning handle to the same message
+	/// @return A new handle. 
+	MsgPtr Share() const noexcept {
+		if (m_msg)
+			static_cast<DelegateMsg*>(m_msg)->AddRef();
+		return MsgPtr(m_msg);
+	}
+
+	/// Release ownership without destroying the message
+	/// @return The message pointer. 
+	T* release() noexcept {
+		T* msg = m_msg;
+		m_msg = nullptr;
+		return msg;
+	}
+
+	/// Release ownership and destroy the message if this is the last owner
+	void reset() noexcept {
+		if (m_msg)
+			static_cast<DelegateMsg*>(release())->Release();
+	}
+
+	T* get() const noexcept { return m_msg; }
+	T* operator->() const noexcept { return m_msg; }
+	T& operator*() const noexcept { return *m_msg; }
+	explicit operator bool() const noexcept { return m_msg != nullptr; }
+
+private:
+	T* m_msg = nullptr;
+};
+
+/// Owning handle to any delegate message
+using DelegateMsgPtr = MsgPtr<DelegateMsg>;
+
+/// @brief Create a message within a pooled memory block.
+/// @param[in] args - the message constructor arguments.
+/// @return The new message handle.
+/// @throws std::bad_alloc If memory allocation fails and DMQ_ASSERTS not defined.
+template <class T, class... Args>
+MsgPtr<T> MakeMsg(Args&&... args)
+{
+	static_assert(std::is_base_of_v<DelegateMsg, T>, "T must derive from DelegateMsg");
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned type not supported");
+
+	void* mem = MsgPool::Allocate(sizeof(T));
+	T* msg = nullptr;
+	try {
+		msg = new(mem) T(std::forward<Args>(args)...);
+	}
+	catch (...) {
+		MsgPool::Deallocate(mem);
+		throw;
+	}
+	static_cast<DelegateMsg*>(msg)->m_block = mem;
+	return MsgPtr<T>(msg);
+}
+
+/// @brief Recover a derived message type without RTTI.
+/// @tparam T The derived message type. `T` must pass `DelegateMsg::TypeIdOf<T>()` to
+/// the `DelegateMsg` constructor.
+/// @param[in] msg - the message.
+/// @return The derived message, or `nullptr` if `msg` is not a `T`.
+template <class T>
+T* MsgCast(DelegateMsg& msg) noexcept
+{
+	static_assert(std::is_base_of_v<DelegateMsg, T>, "T must derive from DelegateMsg");
+	if (msg.GetTypeId() != DelegateMsg::TypeIdOf<T>())
+		return nullptr;
+	return static_cast<T*>(&msg);
+}
+
 }
 
 #endif
@@ -56,6 +56,19 @@ namespace dmq
     typedef std::basic_stringstream<char, std::char_traits<char>> xstringstream;
 #endif
 
+// @TODO: Select the inline delegate storage size in bytes. Delegate containers store a 
+// delegate up to this size without heap allocation; larger delegates use the heap.
+// Must be large enough for the async delegate types to avoid allocation on subscribe.
+#ifndef DMQ_DELEGATE_INLINE_SIZE
+    #define DMQ_DELEGATE_INLINE_SIZE 128
+#endif
+
+// @TODO: Select the subscriber count at which MulticastDelegate builds a hash index 
+// for constant time Remove() and Contains(). Set to 0 to never build the index.
+#ifndef DMQ_MULTICAST_INDEX_THRESHOLD
+    #define DMQ_MULTICAST_INDEX_THRESHOLD 32
+#endif
+
 // @TODO: Select the desired logging (see Predef.cmake).
 #ifdef DMQ_LOG
     #include <spdlog/spdlog.h>
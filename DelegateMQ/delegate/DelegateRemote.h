@@ -205,6 +205,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -648,6 +667,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
@@ -1031,6 +1069,25 @@ public:
         return new(std::nothrow) ClassType(*this);
     }
 
+    /// @brief Creates a copy of the current object within caller supplied storage.
+    /// @details See `Delegate::CloneTo()`. Uses `Clone()` if the object does not fit.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @param[in] size The storage size in bytes.
+    /// @return A pointer to the new `ClassType` instance or nullptr if allocation fails.
+    virtual ClassType* CloneTo(void* buffer, std::size_t size) const override {
+        if (sizeof(ClassType) <= size && alignof(ClassType) <= alignof(std::max_align_t))
+            return ::new(buffer) ClassType(*this);
+        return Clone();
+    }
+
+    /// @brief Moves the current object into caller supplied storage.
+    /// @details See `Delegate::MoveTo()`.
+    /// @param[in] buffer Storage aligned to `alignof(std::max_align_t)`.
+    /// @return A pointer to the new `ClassType` instance.
+    virtual ClassType* MoveTo(void* buffer) noexcept override {
+        return ::new(buffer) ClassType(std::move(*this));
+    }
+
     /// @brief Assignment operator that assigns the state of one object to another.
     /// @param[in] rhs The object whose state is to be assigned to the current object.
     /// @return A reference to the current object.
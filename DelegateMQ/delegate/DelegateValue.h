@@ -0,0 +1,169 @@
+#ifndef _DELEGATE_VALUE_H
+#define _DELEGATE_VALUE_H
+
+/// @file
+/// @brief A delegate value type with small-buffer optimization.
+///
+/// @details `DelegateValue<>` owns a copy of any `Delegate<>` instance. A delegate
+/// that fits within `DMQ_DELEGATE_INLINE_SIZE` bytes is stored inline within the value
+/// itself, so delegate containers subscribe without a heap allocation. A larger delegate
+/// is cloned onto the heap.
+///
+/// Moving a value holding an inline delegate relocates the delegate instance. Do not move
+/// a value while its delegate is executing.
+
+#include "Delegate.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace dmq {
+
+template <class R>
+struct DelegateValue; // Not defined
+
+/// @brief Owns one delegate instance stored inline when small enough, otherwise on
+/// the heap. Not thread-safe.
+/// @tparam RetType The return type of the bound delegate function.
+/// @tparam Args The argument types of the bound delegate function.
+template <class RetType, class... Args>
+class DelegateValue<RetType(Args...)>
+{
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+
+    /// Inline storage size in bytes
+    static constexpr std::size_t INLINE_SIZE = DMQ_DELEGATE_INLINE_SIZE;
+
+    DelegateValue() = default;
+    ~DelegateValue() { Reset(); }
+
+    /// @brief Construct a value holding a copy of a delegate.
+    /// @param[in] delegate The delegate to copy.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    explicit DelegateValue(const DelegateType& delegate) { Assign(delegate); }
+
+    /// @brief Copy constructor.
+    /// @param[in] rhs The object to copy from.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    DelegateValue(const DelegateValue& rhs) {
+        if (rhs.m_delegate)
+            Assign(*rhs.m_delegate);
+    }
+
+    /// @brief Move constructor. An inline delegate is moved; a heap delegate
+    /// transfers ownership.
+    /// @param[in] rhs The object to move from.
+    DelegateValue(DelegateValue&& rhs) noexcept { MoveFrom(rhs); }
+
+    /// @brief Copy assignment operator.
+    /// @param[in] rhs The object to copy from.
+    /// @return A reference to the current object.
+    DelegateValue& operator=(const DelegateValue& rhs) {
+        if (&rhs != this) {
+            Reset();
+            if (rhs.m_delegate)
+                Assign(*rhs.m_delegate);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator.
+    /// @param[in] rhs The object to move from.
+    /// @return A reference to the current object.
+    DelegateValue& operator=(DelegateValue&& rhs) noexcept {
+        if (&rhs != this) {
+            Reset();
+            MoveFrom(rhs);
+        }
+        return *this;
+    }
+
+    /// @brief Replace the held delegate with a copy of `delegate`.
+    /// @param[in] delegate The delegate to copy.
+    /// @return A reference to the current object.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    DelegateValue& operator=(const DelegateType& delegate) {
+        Reset();
+        Assign(delegate);
+        return *this;
+    }
+
+    /// @brief Destroy the held delegate, if any.
+    void operator=(std::nullptr_t) noexcept { Reset(); }
+
+    /// Invoke the held delegate. Must not be empty.
+    /// @param[in] args The arguments used when invoking the target function
+    /// @return The target function return value.
+    RetType operator()(Args... args) const { return (*m_delegate)(args...); }
+
+    /// @brief Compare the held delegate to another delegate.
+    /// @param[in] delegate The delegate to compare.
+    /// @return `true` if not empty and the delegates are equal.
+    bool operator==(const DelegateType& delegate) const {
+        return m_delegate && *m_delegate == delegate;
+    }
+
+    /// @brief Get the held delegate.
+    /// @return The delegate instance, or nullptr if empty.
+    DelegateType* Get() const noexcept { return m_delegate; }
+
+    DelegateType* operator->() const noexcept { return m_delegate; }
+    DelegateType& operator*() const noexcept { return *m_delegate; }
+
+    /// @return `true` if no delegate is held.
+    bool Empty() const noexcept { return m_delegate == nullptr; }
+
+    /// @return `true` if the held delegate is stored inline.
+    bool IsInline() const noexcept {
+        // Range check; the Delegate base subobject need not be at the start of the instance
+        auto p = reinterpret_cast<std::uintptr_t>(m_delegate);
+        auto begin = reinterpret_cast<std::uintptr_t>(m_storage);
+        return m_delegate && p >= begin && p < begin + sizeof(m_storage);
+    }
+
+    /// @brief Implicit conversion operator to `bool`.
+    /// @return `true` if a delegate is held.
+    explicit operator bool() const noexcept { return !Empty(); }
+
+    /// @brief Destroy the held delegate, if any.
+    void Reset() noexcept {
+        if (!m_delegate)
+            return;
+        if (IsInline())
+            m_delegate->~DelegateType();
+        else
+            delete m_delegate;
+        m_delegate = nullptr;
+    }
+
+private:
+    /// Copy a delegate inline if it fits, otherwise onto the heap
+    void Assign(const DelegateType& delegate) {
+        m_delegate = delegate.CloneTo(m_storage, sizeof(m_storage));
+        if (!m_delegate)
+            BAD_ALLOC();
+    }
+
+    /// Take the delegate from rhs. rhs is empty afterwards.
+    void MoveFrom(DelegateValue& rhs) noexcept {
+        if (rhs.IsInline()) {
+            m_delegate = rhs.m_delegate->MoveTo(m_storage);
+            rhs.Reset();
+        }
+        else {
+            m_delegate = rhs.m_delegate;
+            rhs.m_delegate = nullptr;
+        }
+    }
+
+    /// Inline delegate storage
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE];
+
+    /// The held delegate; points to m_storage if inline, otherwise a heap instance
+    DelegateType* m_delegate = nullptr;
+};
+
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef _DELEGATE_FUTURE_H
+#define _DELEGATE_FUTURE_H
+
+/// @file
+/// @brief Non-blocking asynchronous delegate return values.
+///
+/// @details `Future<T>` is returned by the async delegate `AsyncInvokeFuture()`. The
+/// source thread continues immediately and collects the return value later, so several
+/// cross-thread calls can run concurrently:
+///
+/// @code
+/// auto f1 = delegateA.AsyncInvokeFuture(1);
+/// auto f2 = delegateB.AsyncInvokeFuture("x");
+/// if (dmq::WhenAll(std::chrono::milliseconds(100), f1, f2))
+///     Use(f1.Get().value(), f2.Get().value());
+/// @endcode
+///
+/// The shared state is stored within the delegate message itself. A future requires no
+/// allocation beyond the pooled message and does not use `std::future`.
+///
+/// A future is not ready if the destination thread discards the message without invoking
+/// the target (e.g. the message lifetime expired or the thread exited). Always use a
+/// timeout if the message may be discarded.
+
+#include "DelegateMsg.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+namespace dmq {
+
+/// @brief Future state shared between the source thread future and the destination
+/// thread. Base class of the message dispatched by `AsyncInvokeFuture()`.
+/// @tparam T The target function return type.
+template <class T>
+class FutureState : public DelegateMsg
+{
+    static_assert(!std::is_reference_v<T>, "Reference return value not allowed");
+
+public:
+    /// Stored return value type. `bool` placeholder for a `void` return.
+    using ValueType = std::conditional_t<std::is_void_v<T>, bool, T>;
+
+    /// Continuation type. Called with the return value, if any.
+    using Continuation = std::conditional_t<std::is_void_v<T>, std::function<void()>, std::function<void(ValueType&)>>;
+
+    /// Constructor
+    /// @param[in] invoker - the invoker instance
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] typeId - the derived message type identifier
+    FutureState(std::shared_ptr<IThreadInvoker> invoker, Priority priority, const void* typeId) :
+        DelegateMsg(std::move(invoker), priority, typeId) {}
+
+    /// Store the return value and release any waiting thread. Called by the
+    /// destination thread.
+    /// @param[in] value - the return value.
+    void SetValue(ValueType&& value) {
+        Continuation continuation;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_value.emplace(std::move(value));
+            continuation = std::move(m_continuation);
+        }
+
+        // Waiters are released after the continuation so Get() cannot move the
+        // value out while the continuation uses it
+        if (continuation) {
+            if constexpr (std::is_void_v<T>)
+                continuation();
+            else
+                continuation(*m_value);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_ready = true;
+        }
+        m_cv.notify_all();
+    }
+
+    /// Check if the return value is available
+    /// @return `true` if the target function completed.
+    bool IsReady() {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_ready;
+    }
+
+    /// Wait for the return value
+    /// @param[in] timeout - the maximum time to wait.
+    /// @return `true` if the target function completed.
+    bool Wait(Duration timeout) {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (timeout == Duration::max())
+            m_cv.wait(lock, [this] { return m_ready; });
+        else
+            m_cv.wait_for(lock, timeout, [this] { return m_ready; });
+        return m_ready;
+    }
+
+    /// Move the return value out. Call only once after `Wait()` returns `true`.
+    ValueType Take() { return std::move(*m_value); }
+
+    /// Register a continuation called by the destination thread after the target
+    /// function completes, or called immediately if already complete.
+    /// @param[in] continuation - the callable to invoke.
+    void SetContinuation(Continuation continuation) {
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (!m_value.has_value()) {
+                m_continuation = std::move(continuation);
+                return;
+            }
+        }
+        if constexpr (std::is_void_v<T>)
+            continuation();
+        else
+            continuation(*m_value);
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_cv;
+    std::optional<ValueType> m_value;
+    Continuation m_continuation;
+    bool m_ready = false;
+};
+
+/// @brief A move-only handle to an asynchronous delegate return value.
+/// @details Obtained from the async delegate `AsyncInvokeFuture()`. Not thread-safe; use
+/// one future instance from a single thread.
+/// @tparam T The target function return type.
+template <class T>
+class Future
+{
+public:
+    /// The target function return type
+    using ReturnType = T;
+
+    /// Default constructor creates an invalid future
+    Future() = default;
+
+    /// Constructor
+    /// @param[in] state - the shared future state.
+    explicit Future(MsgPtr<FutureState<T>> state) noexcept : m_state(std::move(state)) {}
+
+    Future(Future&&) noexcept = default;
+    Future& operator=(Future&&) noexcept = default;
+
+    /// Check if the future refers to a shared state
+    /// @return `true` if valid. A default constructed future, a future created by an
+    /// empty delegate and a future that has called `Get()` successfully are not valid.
+    bool IsValid() const noexcept { return static_cast<bool>(m_state); }
+
+    /// Check if the target function completed
+    /// @return `true` if the return value is available.
+    bool IsReady() const { return m_state && m_state->IsReady(); }
+
+    /// Wait for the target function to complete
+    /// @param[in] timeout - the maximum time to wait.
+    /// @return `true` if the target function completed.
+    bool Wait(Duration timeout = Duration::max()) const {
+        return m_state && m_state->Wait(timeout);
+    }
+
+    /// Wait for and get the target function return value. The future is invalid
+    /// after a successful call.
+    /// @param[in] timeout - the maximum time to wait.
+    /// @return The return value, or `std::nullopt` if timeout expired. `bool`
+    /// completion status for a `void` return type.
+    auto Get(Duration timeout = Duration::max()) {
+        if constexpr (std::is_void_v<T>) {
+            if (!Wait(timeout))
+                return false;
+            m_state.reset();
+            return true;
+        }
+        else {
+            if (!Wait(timeout))
+                return std::optional<T>();
+            std::optional<T> value(m_state->Take());
+            m_state.reset();
+            return value;
+        }
+    }
+
+    /// Register a continuation invoked on the destination thread when the target
+    /// function completes. Invoked on the calling thread if already complete. Only
+    /// one continuation is supported.
+    /// @param[in] func - the callable. `void(T&)`, or `void()` for a `void` return type.
+    /// @return `true` if registered; `false` if the future is invalid.
+    template <class F>
+    bool Then(F&& func) {
+        if (!m_state)
+            return false;
+        m_state->SetContinuation(typename FutureState<T>::Continuation(std::forward<F>(func)));
+        return true;
+    }
+
+private:
+    MsgPtr<FutureState<T>> m_state;
+};
+
+/// Wait for all futures to complete
+/// @param[in] timeout - the maximum total time to wait.
+/// @param[in] futures - the futures to wait on.
+/// @return `true` if all futures completed within the timeout.
+template <class... Futures>
+bool WhenAll(Duration timeout, const Futures&... futures)
+{
+    if (timeout == Duration::max())
+        return (futures.Wait(timeout) && ...);
+
+    const auto deadline = Clock::now() + timeout;
+    auto remaining = [&deadline]() {
+        auto left = std::chrono::duration_cast<Duration>(deadline - Clock::now());
+        return left > Duration::zero() ? left : Duration::zero();
+    };
+    return (futures.Wait(remaining()) && ...);
+}
+
+}
+
+#endif
@@ -17,9 +17,9 @@ class IThreadInvoker
 {
 public:
 	/// Called to invoke the bound target function by the destination thread of control.
-	/// @param[in] msg The incoming delegate message.
+	/// @param[in] msg The incoming delegate message. The caller retains ownership.
 	/// @return `true` if function was invoked; `false` if failed. 
-	virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) = 0;
+	virtual bool Invoke(DelegateMsg& msg) = 0;
 };
 
 /// @brief Abstract base class to support remote delegate function invoke
@@ -23,10 +23,30 @@ public:
 	/// getting the `DelegateMsg` into an OS message queue. Once `DelegateMsg` is
 	/// on the destination thread of control, the `IInvoker::Invoke()` function
 	/// must be called to execute the target function.
-	/// @param[in] msg A shared pointer to the message.
+	/// @param[in] msg The message handle. Ownership is transferred to the thread. Move 
+	/// the handle through the queue to avoid reference count updates.
 	/// @post The destination thread calls `IThreadInvoker::Invoke()` when `DelegateMsg`
 	/// is received.
-	virtual void DispatchDelegate(std::shared_ptr<DelegateMsg> msg) = 0;
+	virtual void DispatchDelegate(DelegateMsgPtr msg) = 0;
+
+	/// Get the delegate thread executing the caller
+	/// @return The current thread, or `nullptr` if the caller is not a delegate thread
+	/// or the implementation does not call `SetCurrent()`.
+	static IThread* GetCurrent() noexcept { return t_current; }
+
+	/// Check if the caller is executing on this thread. Delegates invoke the target 
+	/// function synchronously instead of dispatching when appropriate.
+	/// @return `true` if called from this thread. The default implementation uses 
+	/// `GetCurrent()`.
+	virtual bool IsCurrentThread() const { return GetCurrent() == this; }
+
+protected:
+	/// Register this instance as the delegate thread executing the calling OS thread. 
+	/// Called by the implementation at the start of the thread loop.
+	void SetCurrent() noexcept { t_current = this; }
+
+private:
+	static inline thread_local IThread* t_current = nullptr;
 };
 
 }
@@ -0,0 +1,278 @@
+#ifndef _MSG_POOL_H
+#define _MSG_POOL_H
+
+/// @file
+/// @brief Pooled storage for delegate inter-thread messages.
+///
+/// @details `MsgPool` recycles message memory blocks using per-thread caches so that
+/// steady-state asynchronous dispatch does not allocate from the global heap. A block
+/// is always owned by the cache of the thread that first allocated it:
+///
+/// * A block freed on the owning thread is pushed onto the cache local free list.
+/// * A block freed on another thread (e.g. the destination thread after invoking the
+///   target) is pushed onto the owner cache lock-free remote free list. The owner
+///   reclaims the whole remote list when its local list runs empty.
+///
+/// Both lists hold at most `MAX_CACHED_BLOCKS` per size class; excess blocks are
+/// returned to the global heap.
+///
+/// When a thread exits its cache, including any cached blocks, is handed to the next
+/// thread that uses the pool. The remote lists are reclaimed first. Blocks still in
+/// flight keep returning to that cache.
+///
+/// Requests larger than the largest size class, or made after the thread cache is
+/// destroyed, use the global heap. Use `MakeMsg<T>()` in `DelegateMsg.h` to construct 
+/// a message within a pooled block.
+
+#include "DelegateOpt.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef DMQ_ALLOCATOR
+    #include "predef/allocator/xallocator.h"
+#endif
+
+namespace dmq {
+
+/// @brief Per-thread size class block pool for delegate messages. Thread-safe.
+class MsgPool
+{
+public:
+    /// Smallest block size including the block header. Each larger size class doubles.
+    static constexpr size_t MIN_BLOCK_SIZE = 64;
+
+    /// Number of size classes (64, 128, 256, 512 and 1024 bytes)
+    static constexpr size_t SIZE_CLASSES = 5;
+
+    /// Maximum free blocks held per size class in a thread local or remote free list
+    static constexpr size_t MAX_CACHED_BLOCKS = 256;
+
+    /// Allocate a memory block.
+    /// @param[in] size - the requested size in bytes.
+    /// @return A block aligned to `alignof(std::max_align_t)`.
+    /// @throws std::bad_alloc If memory allocation fails and DMQ_ASSERTS not defined.
+    static void* Allocate(size_t size)
+    {
+        size_t sizeClass = GetSizeClass(size + sizeof(Header));
+        Cache* cache = (sizeClass < SIZE_CLASSES) ? GetCache() : nullptr;
+
+        void* block = nullptr;
+        if (cache)
+        {
+            block = cache->Pop(sizeClass);
+            if (!block)
+                block = RawAllocate(MIN_BLOCK_SIZE << sizeClass);
+        }
+        else
+        {
+            block = RawAllocate(size + sizeof(Header));
+        }
+
+        Header* header = new(block) Header;
+        header->owner = cache;
+        header->sizeClass = sizeClass;
+        return header + 1;
+    }
+
+    /// Free a block returned by `Allocate()`. May be called from any thread.
+    /// @param[in] ptr - the block to free.
+    static void Deallocate(void* ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        Header* header = static_cast<Header*>(ptr) - 1;
+        Cache* owner = header->owner;
+        size_t sizeClass = header->sizeClass;
+
+        if (!owner)
+            RawDeallocate(header);
+        else if (owner == t_cache)
+            owner->PushLocal(sizeClass, header);
+        else
+            owner->PushRemote(sizeClass, header);
+    }
+
+private:
+    struct Cache;
+
+    /// Header stored in front of every block
+    struct alignas(std::max_align_t) Header
+    {
+        Cache* owner;
+        size_t sizeClass;
+    };
+
+    /// Free list node overlaid on an unused block
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    /// Free lists for one thread
+    struct Cache
+    {
+        FreeBlock* local[SIZE_CLASSES] = {};
+        size_t localCount[SIZE_CLASSES] = {};
+        std::atomic<FreeBlock*> remote[SIZE_CLASSES] = {};
+        std::atomic<size_t> remoteCount[SIZE_CLASSES] = {};
+
+        /// Get a free block. Called by the owner thread only.
+        void* Pop(size_t sizeClass)
+        {
+            if (!local[sizeClass])
+                Reclaim(sizeClass);
+
+            FreeBlock* block = local[sizeClass];
+            if (block)
+            {
+                local[sizeClass] = block->next;
+                localCount[sizeClass]--;
+            }
+            return block;
+        }
+
+        /// Return a block. Called by the owner thread only.
+        void PushLocal(size_t sizeClass, void* ptr)
+        {
+            if (localCount[sizeClass] >= MAX_CACHED_BLOCKS)
+            {
+                RawDeallocate(ptr);
+                return;
+            }
+            FreeBlock* block = new(ptr) FreeBlock;
+            block->next = local[sizeClass];
+            local[sizeClass] = block;
+            localCount[sizeClass]++;
+        }
+
+        /// Move all blocks freed by other threads to the local free list. Called by
+        /// the owner thread only.
+        void Reclaim(size_t sizeClass)
+        {
+            FreeBlock* list = remote[sizeClass].exchange(nullptr, std::memory_order_acquire);
+            size_t count = 0;
+            while (list)
+            {
+                FreeBlock* next = list->next;
+                PushLocal(sizeClass, list);
+                list = next;
+                count++;
+            }
+            remoteCount[sizeClass].fetch_sub(count, std::memory_order_relaxed);
+        }
+
+        /// Return a block. Called by any non-owner thread.
+        void PushRemote(size_t sizeClass, void* ptr)
+        {
+            // An orphaned or idle owner may not reclaim for a long time
+            if (remoteCount[sizeClass].fetch_add(1, std::memory_order_relaxed) >= MAX_CACHED_BLOCKS)
+            {
+                remoteCount[sizeClass].fetch_sub(1, std::memory_order_relaxed);
+                RawDeallocate(ptr);
+                return;
+            }
+            FreeBlock* block = new(ptr) FreeBlock;
+            block->next = remote[sizeClass].load(std::memory_order_relaxed);
+            while (!remote[sizeClass].compare_exchange_weak(block->next, block,
+                std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+    };
+
+    /// Releases the thread cache at thread exit
+    struct CacheHolder
+    {
+        CacheHolder() { t_cache = Adopt(); }
+        ~CacheHolder() { Orphan(t_cache); t_cache = nullptr; t_exited = true; }
+    };
+
+    /// Get the size class for a block size, or SIZE_CLASSES if too large
+    static size_t GetSizeClass(size_t blockSize)
+    {
+        size_t sizeClass = 0;
+        while (sizeClass < SIZE_CLASSES && (MIN_BLOCK_SIZE << sizeClass) < blockSize)
+            sizeClass++;
+        return sizeClass;
+    }
+
+    /// Get the calling thread cache, or nullptr if the thread is exiting
+    static Cache* GetCache()
+    {
+        if (!t_cache && !t_exited)
+        {
+            static thread_local CacheHolder holder;
+        }
+        return t_cache;
+    }
+
+    /// Take a cache released by an exited thread or create a new one
+    static Cache* Adopt()
+    {
+        std::lock_guard<std::mutex> lock(GetLock());
+        auto& orphans = GetOrphans();
+        if (!orphans.empty())
+        {
+            Cache* cache = orphans.back();
+            orphans.pop_back();
+            return cache;
+        }
+        return new Cache();
+    }
+
+    /// Release a cache for use by another thread. Called by the owner thread.
+    static void Orphan(Cache* cache)
+    {
+        for (size_t sizeClass = 0; sizeClass < SIZE_CLASSES; sizeClass++)
+            cache->Reclaim(sizeClass);
+
+        std::lock_guard<std::mutex> lock(GetLock());
+        GetOrphans().push_back(cache);
+    }
+
+    static void* RawAllocate(size_t size)
+    {
+#ifdef DMQ_ALLOCATOR
+        void* ptr = xmalloc(size);
+#else
+        void* ptr = ::operator new(size, std::nothrow);
+#endif
+        if (!ptr)
+            BAD_ALLOC();
+        return ptr;
+    }
+
+    static void RawDeallocate(void* ptr) noexcept
+    {
+#ifdef DMQ_ALLOCATOR
+        xfree(ptr);
+#else
+        ::operator delete(ptr);
+#endif
+    }
+
+    /// Get lock using the "Immortal" Pattern. Caches must outlive any message.
+    static std::mutex& GetLock()
+    {
+        static std::mutex* lock = new std::mutex();
+        return *lock;
+    }
+
+    /// Get caches released by exited threads using the "Immortal" Pattern
+    static std::vector<Cache*>& GetOrphans()
+    {
+        static std::vector<Cache*>* orphans = new std::vector<Cache*>();
+        return *orphans;
+    }
+
+    static inline thread_local Cache* t_cache = nullptr;
+    static inline thread_local bool t_exited = false;
+};
+
+}
+
+#endif
@@ -5,10 +5,34 @@
 /// @brief Delegate container for storing and iterating over a collection of 
 /// delegate instances. Supports reentrant removal during invocation. 
 /// Class is not thread-safe.
-
-#include "Delegate.h"
-#include <list>
+///
+/// @details Delegates are stored by value in a contiguous array (see `DelegateValue`), so 
+/// subscribing a typical delegate does not allocate beyond the array growth and a broadcast 
+/// walks adjacent delegates instead of list nodes. A delegate removed during a broadcast is 
+/// marked removed and destroyed once the outermost broadcast completes. A delegate inserted 
+/// during a broadcast is held in a pending queue, since growing the array would relocate 
+/// a delegate that may be executing, and is moved into the array afterwards.
+///
+/// Once the container holds `DMQ_MULTICAST_INDEX_THRESHOLD` delegates, it maintains an 
+/// open addressing hash index keyed on `Delegate::Hash()` so `Remove()` and `Contains()` 
+/// take constant time. The index reuses its storage, so steady insert and remove churn 
+/// does not allocate. While indexed, a removed delegate is destroyed immediately but its array slot 
+/// is reclaimed in bulk once half of the slots are unused.
+///
+/// Each inserted delegate is assigned an increasing slot identifier. The array stays 
+/// sorted by identifier, so `RemoveSlot()` finds a delegate by binary search without 
+/// comparing delegates.
+///
+/// A broadcast groups `DelegateAsync` delegates by destination thread and priority and 
+/// sends one message per group holding a single argument copy. See `BroadcastFusion.h`.
+
+#include "DelegateValue.h"
+#include "BroadcastFusion.h"
+#include "ParallelBroadcast.h"
+#include <vector>
+#include <deque>
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 
 namespace dmq {
@@ -16,7 +40,7 @@ namespace dmq {
 template <class R>
 struct MulticastDelegate; // Not defined
 
-/// @brief Not thread-safe multicast delegate container class. The class has a list of 
+/// @brief Not thread-safe multicast delegate container class. The class has an array of 
 /// `Delegate<>` instances. When invoked, each `Delegate` instance within the invocation 
 /// list is called. 
 template<class RetType, class... Args>
@@ -25,6 +49,9 @@ class MulticastDelegate<RetType(Args...)>
 public:
     using DelegateType = Delegate<RetType(Args...)>;
 
+    /// Identifies one inserted delegate. See `PushBackSlot()`.
+    using SlotId = std::uint64_t;
+
     MulticastDelegate() = default;
     ~MulticastDelegate() { Clear(); }
 
@@ -37,7 +64,7 @@ public:
 
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
-    MulticastDelegate(MulticastDelegate&& rhs) noexcept : m_delegates(std::move(rhs.m_delegates)) { }
+    MulticastDelegate(MulticastDelegate&& rhs) noexcept { MoveFrom(rhs); }
 
     /// Invoke all bound target functions. Safe to remove delegates during invocation.
     /// A void return value is used since multiple targets invoked.
@@ -46,11 +73,32 @@ public:
         // RAII Guard: Increments now, Decrements + Cleans up on return/throw
         BroadcastGuard guard(m_broadcastCount, this);
 
-        // Iterate safely
-        for (auto it = m_delegates.begin(); it != m_delegates.end(); ++it) {
-            std::shared_ptr<DelegateType>& delegate = *it;
-            if (delegate) {
-                (*delegate)(args...);
+        // Iterate by index. The array does not change during a broadcast; a delegate 
+        // inserted by a target function is appended to the pending queue, which does not 
+        // relocate existing elements, and is invoked by this broadcast.
+        if constexpr (Fusion::ENABLED) {
+            // Async delegates sharing a destination thread receive one message. 
+            // Messages are dispatched before an unfused delegate is invoked, so 
+            // delegates are invoked in subscription order.
+            Fusion fusion(args...);
+            for (std::size_t i = 0; i < m_delegates.size(); i++) {
+                if (!m_delegates[i].removed && !fusion.Add(*m_delegates[i].delegate))
+                    m_delegates[i].delegate(args...);
+            }
+            for (std::size_t i = 0; i < m_pending.size(); i++) {
+                if (!m_pending[i].removed && !fusion.Add(*m_pending[i].delegate))
+                    m_pending[i].delegate(args...);
+            }
+            fusion.Dispatch();
+        }
+        else {
+            for (std::size_t i = 0; i < m_delegates.size(); i++) {
+                if (!m_delegates[i].removed)
+                    m_delegates[i].delegate(args...);
+            }
+            for (std::size_t i = 0; i < m_pending.size(); i++) {
+                if (!m_pending[i].removed)
+                    m_pending[i].delegate(args...);
             }
         }
     }
@@ -62,6 +110,29 @@ public:
         (*this)(args...);
     }
 
+    /// Invoke all bound target functions in parallel. The delegates are partitioned 
+    /// across the calling thread and the worker threads; returns once all complete. 
+    /// Use for CPU-heavy synchronous targets.
+    /// @details Target functions run concurrently and receive the same arguments, so 
+    /// only by value, `const T&` and `const T*` arguments are supported. Target functions 
+    /// must not modify this container. Each worker thread must be running and able to 
+    /// process messages, otherwise the broadcast blocks until it does.
+    /// @param[in] workers The worker threads. The calling thread is skipped if listed.
+    /// @param[in] args The arguments used when invoking the target functions
+    /// @throws Rethrows the first exception thrown by a target function.
+    void BroadcastParallel(const std::vector<IThread*>& workers, Args... args) {
+        ParallelTargets targets;
+        BeginParallel(targets);
+        try {
+            InvokeParallel(workers, targets, args...);
+        }
+        catch (...) {
+            EndParallel();
+            throw;
+        }
+        EndParallel();
+    }
+
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
     void operator+=(const DelegateType& delegate) { PushBack(delegate); }
@@ -94,7 +165,15 @@ public:
     /// @return A reference to the current object.
     MulticastDelegate& operator=(MulticastDelegate&& rhs) noexcept {
         if (&rhs != this) {
-            m_delegates = std::move(rhs.m_delegates);
+            Clear();
+            if (m_broadcastCount > 0) {
+                // The broadcast in progress may be executing a delegate; copy instead
+                CopyFrom(rhs);
+                rhs.Clear();
+            }
+            else {
+                MoveFrom(rhs);
+            }
         }
         return *this;
     }
@@ -104,90 +183,405 @@ public:
 
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
-    void PushBack(const DelegateType& delegate) { 
-        auto delegateClone = delegate.Clone();
-        if (!delegateClone)
-            BAD_ALLOC();
+    void PushBack(const DelegateType& delegate) { PushBackSlot(delegate); }
 
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    /// @return The slot identifier used to remove this delegate with `RemoveSlot()`.
+    SlotId PushBackSlot(const DelegateType& delegate) { 
+        SlotId id = m_nextId;
         try {
-            std::shared_ptr<DelegateType> sharedDelegate(delegateClone);
-            m_delegates.push_back(std::forward<std::shared_ptr<DelegateType>>(sharedDelegate));
+            if (m_broadcastCount > 0 || !m_pending.empty()) {
+                // REENTRANCY DETECTED: growing the array may relocate an executing delegate.
+                // Also queue behind delegates still pending so slot identifiers stay sorted.
+                m_pending.emplace_back(delegate, id);
+                m_cleanup = true;
+            }
+            else {
+                m_delegates.emplace_back(delegate, id);
+                try {
+                    AddIndex(m_delegates.size() - 1);
+                }
+                catch (const std::bad_alloc&) {
+                    m_delegates.pop_back();
+                    throw;
+                }
+            }
         }
         catch (const std::bad_alloc&) {
             BAD_ALLOC();
         }
+        m_nextId++;
+        return id;
     }
 
     /// Remove a delegate into the container.
     /// @param[in] delegate The delegate target to remove.
     void Remove(const DelegateType& delegate) {
-        auto it = std::find_if(m_delegates.begin(), m_delegates.end(),
-            [&delegate](const std::shared_ptr<DelegateType>& item) {
-                // Must check if item is valid before comparing!
-                return item && (*item == delegate);
-            });
+        std::size_t pos = Find(delegate);
+        if (pos < m_delegates.size()) {
+            RemoveAt(pos);
+            return;
+        }
 
-        if (it != m_delegates.end()) {
-            if (m_broadcastCount > 0) {
-                // REENTRANCY DETECTED: 
-                // Do not erase(). Just null out the pointer.
-                // The iterator in operator() stays valid, but next access sees null.
-                it->reset();
-                m_cleanup = true;
-            }
-            else {
-                // Safe to erase immediately
-                m_delegates.erase(it);
-            }
+        // Pending delegates exist only during a broadcast
+        auto pendingIt = std::find_if(m_pending.begin(), m_pending.end(), 
+            [&delegate](const Slot& slot) { return !slot.removed && slot.delegate == delegate; });
+        if (pendingIt != m_pending.end())
+            MarkRemoved(*pendingIt);
+    }
+
+    /// Remove a delegate inserted by `PushBackSlot()`.
+    /// @param[in] id The slot identifier.
+    /// @return `true` if the delegate was removed; `false` if not found.
+    bool RemoveSlot(SlotId id) {
+        auto byId = [](const Slot& slot, SlotId value) { return slot.id < value; };
+
+        auto it = std::lower_bound(m_delegates.begin(), m_delegates.end(), id, byId);
+        if (it != m_delegates.end() && it->id == id) {
+            if (it->removed)
+                return false;
+            RemoveAt(static_cast<std::size_t>(it - m_delegates.begin()));
+            return true;
+        }
+
+        auto pendingIt = std::lower_bound(m_pending.begin(), m_pending.end(), id, byId);
+        if (pendingIt != m_pending.end() && pendingIt->id == id && !pendingIt->removed) {
+            MarkRemoved(*pendingIt);
+            return true;
         }
+        return false;
+    }
+
+    /// Check if the container holds a delegate.
+    /// @param[in] delegate The delegate target to find.
+    /// @return `true` if an equal delegate is registered.
+    bool Contains(const DelegateType& delegate) const {
+        if (Find(delegate) < m_delegates.size())
+            return true;
+        return std::any_of(m_pending.begin(), m_pending.end(), 
+            [&delegate](const Slot& slot) { return !slot.removed && slot.delegate == delegate; });
     }
 
     /// Any registered delegates?
     /// @return `true` if delegate container is empty.
-    bool Empty() const { return m_delegates.empty(); }
+    bool Empty() const { return Size() == 0; }
 
     /// Removal all registered delegates.
-    void Clear() { m_delegates.clear(); }
+    void Clear() { 
+        if (m_broadcastCount > 0) {
+            ClearIndex();
+            // Mark every delegate removed; the broadcast in progress may be executing one
+            for (auto& slot : m_delegates) {
+                if (!slot.removed)
+                    MarkRemoved(slot);
+            }
+            for (auto& slot : m_pending) {
+                if (!slot.removed)
+                    MarkRemoved(slot);
+            }
+        }
+        else {
+            m_delegates.clear();
+            m_pending.clear();
+            m_removedCount = 0;
+            m_index.clear();
+            m_indexUsed = 0;
+            m_indexed = false;
+        }
+    }
 
     /// Get the number of delegates stored.
     /// @return The number of delegates stored.
-    std::size_t Size() const { return m_delegates.size(); }
+    std::size_t Size() const { return m_delegates.size() + m_pending.size() - m_removedCount; }
 
     /// @brief Implicit conversion operator to `bool`.
     /// @return `true` if the container is not empty, `false` if the container is empty.
     explicit operator bool() const { return !Empty(); }
 
+protected:
+    /// The delegates invoked by a parallel broadcast
+    using ParallelTargets = std::vector<DelegateType*>;
+
+    /// Start a parallel broadcast. The delegates are not relocated or destroyed until 
+    /// `EndParallel()`, so a thread-safe container may invoke them without its lock.
+    /// @param[out] targets The registered delegates.
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void BeginParallel(ParallelTargets& targets) {
+        try {
+            targets.reserve(Size());
+        }
+        catch (const std::bad_alloc&) {
+            BAD_ALLOC();
+        }
+        m_broadcastCount++;
+        for (auto& slot : m_delegates) {
+            if (!slot.removed)
+                targets.push_back(slot.delegate.Get());
+        }
+        for (auto& slot : m_pending) {
+            if (!slot.removed)
+                targets.push_back(slot.delegate.Get());
+        }
+    }
+
+    /// Complete a parallel broadcast started by `BeginParallel()`
+    void EndParallel() noexcept {
+        if (--m_broadcastCount == 0)
+            Cleanup();
+    }
+
+    /// Invoke the delegates of a parallel broadcast. See `BroadcastParallel()`.
+    /// @param[in] workers The worker threads.
+    /// @param[in] targets The delegates to invoke.
+    /// @param[in] args The arguments used when invoking the target functions
+    /// @throws Rethrows the first exception thrown by a target function.
+    static void InvokeParallel(const std::vector<IThread*>& workers, const ParallelTargets& targets, Args... args) {
+        static_assert(std::conjunction_v<trait::is_fusable_arg<Args>...>,
+            "BroadcastParallel() shares the arguments between threads. Non-const reference and pointer arguments are not supported.");
+
+        auto invokeRange = [&targets, &args...](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                (*targets[i])(args...);
+        };
+        ParallelFor(workers, targets.size(), invokeRange);
+    }
+
 private:
+    using Fusion = BroadcastFusion<RetType, Args...>;
+
+    /// A registered delegate
+    struct Slot {
+        Slot(const DelegateType& d, SlotId slotId) : delegate(d), hash(d.Hash()), id(slotId) {}
+
+        /// The delegate stored by value
+        DelegateValue<RetType(Args...)> delegate;
+
+        /// The delegate hash when inserted
+        std::size_t hash;
+
+        /// The slot identifier. Increases with array position.
+        SlotId id;
+
+        /// Removed; destroyed once the broadcast completes
+        bool removed = false;
+    };
+
+    /// Find the first registered delegate in the array
+    /// @param[in] delegate The delegate target to find.
+    /// @return The array position, or the array size if not found.
+    std::size_t Find(const DelegateType& delegate) const {
+        if (m_indexed) {
+            std::size_t found = m_delegates.size();
+            std::size_t hash = delegate.Hash();
+            std::size_t mask = m_index.size() - 1;
+            for (std::size_t i = Mix(hash) & mask; m_index[i].pos != INDEX_EMPTY; i = (i + 1) & mask) {
+                // Lowest position removes duplicates in the same order as a linear search
+                const IndexEntry& entry = m_index[i];
+                if (entry.pos < found && entry.hash == hash && m_delegates[entry.pos].delegate == delegate)
+                    found = entry.pos;
+            }
+            return found;
+        }
+
+        for (std::size_t pos = 0; pos < m_delegates.size(); pos++) {
+            // Must skip removed slots before comparing!
+            const Slot& slot = m_delegates[pos];
+            if (!slot.removed && slot.delegate == delegate)
+                return pos;
+        }
+        return m_delegates.size();
+    }
+
+    /// Remove the delegate at an array position
+    /// @param[in] pos The array position.
+    void RemoveAt(std::size_t pos) {
+        Slot& slot = m_delegates[pos];
+        EraseIndex(pos);
+        if (m_broadcastCount > 0) {
+            // REENTRANCY DETECTED: 
+            // Do not erase(). Mark the slot removed so indexes in operator() stay 
+            // valid. The delegate may be executing, so destroy it after the broadcast.
+            MarkRemoved(slot);
+        }
+        else if (m_indexed) {
+            // Erasing shifts the indexed positions. Destroy the delegate now and 
+            // reclaim the unused slots in bulk.
+            slot.delegate = nullptr;
+            slot.removed = true;
+            m_removedCount++;
+            if (m_removedCount * 2 > m_delegates.size())
+                Compact();
+        }
+        else {
+            // Safe to erase immediately
+            m_delegates.erase(m_delegates.begin() + pos);
+        }
+    }
+
+    /// Index a newly inserted array slot. Builds the index once the threshold is reached.
+    /// @param[in] pos The array position.
+    void AddIndex(std::size_t pos) {
+        if (m_indexed) {
+            // Keep the load factor at most 1/2 so probes stay short and terminate
+            if ((m_indexUsed + 1) * 2 > m_index.size())
+                RebuildIndex();
+            else
+                InsertIndex(m_delegates[pos].hash, pos);
+        }
+        else if (DMQ_MULTICAST_INDEX_THRESHOLD > 0 && Size() >= DMQ_MULTICAST_INDEX_THRESHOLD) {
+            RebuildIndex();
+        }
+    }
+
+    /// Insert an index entry. The index must have a free entry.
+    /// @param[in] hash The delegate hash.
+    /// @param[in] pos The array position.
+    void InsertIndex(std::size_t hash, std::size_t pos) noexcept {
+        std::size_t mask = m_index.size() - 1;
+        std::size_t i = Mix(hash) & mask;
+        while (m_index[i].pos < INDEX_DELETED)
+            i = (i + 1) & mask;
+        if (m_index[i].pos == INDEX_EMPTY)
+            m_indexUsed++;
+        m_index[i] = { hash, pos };
+    }
+
+    /// Remove an array slot from the index
+    /// @param[in] pos The array position.
+    void EraseIndex(std::size_t pos) noexcept {
+        if (!m_indexed)
+            return;
+        std::size_t mask = m_index.size() - 1;
+        for (std::size_t i = Mix(m_delegates[pos].hash) & mask; m_index[i].pos != INDEX_EMPTY; i = (i + 1) & mask) {
+            if (m_index[i].pos == pos) {
+                // Leave a marker so probes continue past this entry
+                m_index[i].pos = INDEX_DELETED;
+                return;
+            }
+        }
+    }
+
+    /// Remove all index entries, keeping the storage
+    void ClearIndex() noexcept {
+        std::fill(m_index.begin(), m_index.end(), IndexEntry{ 0, INDEX_EMPTY });
+        m_indexUsed = 0;
+    }
+
+    /// Rebuild the index from the array. Drops the index if below the threshold 
+    /// or out of memory; a linear search is always correct.
+    void RebuildIndex() noexcept {
+        m_indexed = DMQ_MULTICAST_INDEX_THRESHOLD > 0 && Size() >= DMQ_MULTICAST_INDEX_THRESHOLD;
+        if (!m_indexed) {
+            m_index.clear();
+            m_indexUsed = 0;
+            return;
+        }
+
+        // Power of two capacity of at least twice the entry count. Never shrinks.
+        std::size_t capacity = 16;
+        while (capacity < m_delegates.size() * 2)
+            capacity *= 2;
+        try {
+            if (m_index.size() < capacity)
+                m_index.resize(capacity);
+        }
+        catch (const std::bad_alloc&) {
+            m_index.clear();
+            m_indexUsed = 0;
+            m_indexed = false;
+            return;
+        }
+
+        ClearIndex();
+        for (std::size_t pos = 0; pos < m_delegates.size(); pos++) {
+            if (!m_delegates[pos].removed)
+                InsertIndex(m_delegates[pos].hash, pos);
+        }
+    }
+
+    /// Spread the hash bits for the index probe start
+    static std::size_t Mix(std::size_t hash) noexcept {
+        hash ^= hash >> 16;
+        hash *= static_cast<std::size_t>(0x45d9f3b);
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    /// Erase all removed slots from the array. Not called during a broadcast.
+    void Compact() noexcept {
+        auto isRemoved = [](const Slot& slot) { return slot.removed; };
+        m_delegates.erase(std::remove_if(m_delegates.begin(), m_delegates.end(), isRemoved), m_delegates.end());
+        m_removedCount = 0;
+        RebuildIndex();
+    }
+
     /// Copy all delegate container objects.
     /// @param[in] other The container to copy from
     void CopyFrom(const MulticastDelegate& other) {
-        for (auto delegate : other.m_delegates) {
-            auto delegateClone = delegate->Clone();
-            if (!delegateClone)
-                BAD_ALLOC();
-
-            try {
-                std::shared_ptr<DelegateType> sharedDelegate(delegateClone);
-                m_delegates.push_back(sharedDelegate);
-            }
-            catch (const std::bad_alloc&) {
-                BAD_ALLOC();
-            }
+        for (const auto& slot : other.m_delegates) {
+            if (!slot.removed)
+                PushBack(*slot.delegate);
         }
+        for (const auto& slot : other.m_pending) {
+            if (!slot.removed)
+                PushBack(*slot.delegate);
+        }
+    }
+
+    /// Take all delegates from another container. rhs is empty afterwards.
+    /// @param[in] rhs The container to move from
+    void MoveFrom(MulticastDelegate& rhs) noexcept {
+        // Moving the array keeps each element at the same address
+        m_delegates = std::move(rhs.m_delegates);
+        m_pending = std::move(rhs.m_pending);
+        m_index = std::move(rhs.m_index);
+        m_indexUsed = rhs.m_indexUsed;
+        m_removedCount = rhs.m_removedCount;
+        m_nextId = rhs.m_nextId;
+        m_indexed = rhs.m_indexed;
+        m_cleanup = rhs.m_cleanup;
+        rhs.m_delegates.clear();
+        rhs.m_pending.clear();
+        rhs.m_index.clear();
+        rhs.m_indexUsed = 0;
+        rhs.m_removedCount = 0;
+        rhs.m_indexed = false;
+        rhs.m_cleanup = false;
+    }
+
+    /// Mark a delegate removed during a broadcast
+    /// @param[in] slot The slot to mark
+    void MarkRemoved(Slot& slot) {
+        slot.removed = true;
+        m_removedCount++;
+        m_cleanup = true;
     }
 
     /// Deferred cleanup (soft delete) if reentrency detected
-    void Cleanup() {
+    void Cleanup() noexcept {
         // Skip cleanup if nothing removed
         if (!m_cleanup)
             return;
 
-        // Efficiently remove all null pointers from the list
-        m_delegates.remove_if([](const std::shared_ptr<DelegateType>& item) {
-            return item == nullptr;
-            });
+        // Efficiently remove all removed slots from the array
+        auto isRemoved = [](const Slot& slot) { return slot.removed; };
+        m_delegates.erase(std::remove_if(m_delegates.begin(), m_delegates.end(), isRemoved), m_delegates.end());
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), isRemoved), m_pending.end());
+        m_removedCount = 0;
 
-        m_cleanup = false;
+        // Append delegates inserted during the broadcast. If out of memory, the 
+        // remaining delegates stay pending, where they are still invoked.
+        try {
+            while (!m_pending.empty()) {
+                m_delegates.push_back(std::move(m_pending.front()));
+                m_pending.pop_front();
+            }
+            m_cleanup = false;
+        }
+        catch (const std::bad_alloc&) {
+        }
+        RebuildIndex();
     }
 
     class BroadcastGuard {
@@ -207,8 +601,38 @@ private:
         MulticastDelegate* m_container;
     };
 
-    /// List of registered delegates
-    xlist<std::shared_ptr<DelegateType>> m_delegates;
+    /// Array of registered delegates
+    std::vector<Slot> m_delegates;
+
+    /// Delegates inserted during a broadcast. A deque does not relocate existing 
+    /// elements on insertion.
+    std::deque<Slot> m_pending;
+
+    /// Index entry position markers
+    static constexpr std::size_t INDEX_EMPTY = static_cast<std::size_t>(-1);
+    static constexpr std::size_t INDEX_DELETED = static_cast<std::size_t>(-2);
+
+    /// An array position and its delegate hash
+    struct IndexEntry {
+        std::size_t hash;
+        std::size_t pos;
+    };
+
+    /// Open addressing index of array positions keyed on the delegate hash. Removed 
+    /// slots are not indexed. Size is zero or a power of two.
+    std::vector<IndexEntry> m_index;
+
+    /// Number of index entries not empty, including deleted markers
+    std::size_t m_indexUsed = 0;
+
+    /// Number of slots marked removed
+    std::size_t m_removedCount = 0;
+
+    /// The next slot identifier
+    SlotId m_nextId = 1;
+
+    /// `true` if m_index is maintained
+    bool m_indexed = false;
 
     /// Count of active nested broadcasts
     int m_broadcastCount = 0;
@@ -50,6 +50,31 @@ public:
         BaseType::Broadcast(args...);
     }
 
+    /// Invoke all bound target functions in parallel. See `MulticastDelegate::BroadcastParallel()`.
+    /// @details The lock is not held while the target functions run, so a target function 
+    /// may modify this container from any thread. The delegates registered when the 
+    /// broadcast starts are invoked, including any removed during the broadcast.
+    /// @param[in] workers The worker threads.
+    /// @param[in] args The arguments used when invoking the target functions
+    /// @throws Rethrows the first exception thrown by a target function.
+    void BroadcastParallel(const std::vector<IThread*>& workers, Args... args) {
+        typename BaseType::ParallelTargets targets;
+        {
+            const std::lock_guard<std::recursive_mutex> lock(m_lock);
+            BaseType::BeginParallel(targets);
+        }
+        try {
+            BaseType::InvokeParallel(workers, targets, args...);
+        }
+        catch (...) {
+            const std::lock_guard<std::recursive_mutex> lock(m_lock);
+            BaseType::EndParallel();
+            throw;
+        }
+        const std::lock_guard<std::recursive_mutex> lock(m_lock);
+        BaseType::EndParallel();
+    }
+
     /// Insert a delegate into the container.
     /// @param[in] delegate A delegate target to insert
     void operator+=(const Delegate<RetType(Args...)>& delegate) {
@@ -114,6 +139,14 @@ public:
         BaseType::PushBack(delegate);
     }
 
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    /// @return The slot identifier used to remove this delegate with `RemoveSlot()`.
+    typename BaseType::SlotId PushBackSlot(const DelegateType& delegate) {
+        const std::lock_guard<std::recursive_mutex> lock(m_lock);
+        return BaseType::PushBackSlot(delegate);
+    }
+
     /// Remove a delegate into the container.
     /// @param[in] delegate The delegate target to remove.
     void Remove(const DelegateType& delegate) {
@@ -121,6 +154,22 @@ public:
         BaseType::Remove(delegate);
     }
 
+    /// Remove a delegate inserted by `PushBackSlot()`.
+    /// @param[in] id The slot identifier.
+    /// @return `true` if the delegate was removed; `false` if not found.
+    bool RemoveSlot(typename BaseType::SlotId id) {
+        const std::lock_guard<std::recursive_mutex> lock(m_lock);
+        return BaseType::RemoveSlot(id);
+    }
+
+    /// Check if the container holds a delegate.
+    /// @param[in] delegate The delegate target to find.
+    /// @return `true` if an equal delegate is registered.
+    bool Contains(const DelegateType& delegate) const {
+        const std::lock_guard<std::recursive_mutex> lock(m_lock);
+        return BaseType::Contains(delegate);
+    }
+
     /// Any registered delegates?
     /// @return `true` if delegate container is empty.
     bool Empty() const {
@@ -0,0 +1,170 @@
+#ifndef _MULTICAST_DELEGATE_SNAPSHOT_H
+#define _MULTICAST_DELEGATE_SNAPSHOT_H
+
+/// @file
+/// @brief Delegate container for storing and iterating over a collection of
+/// delegate instances. Class is thread-safe. Broadcasts do not hold a lock.
+///
+/// @details Read-copy-update (RCU) container. A broadcast atomically loads the current
+/// immutable subscriber array and invokes each delegate without holding any lock.
+/// Insert and remove copy the array, modify the copy, then atomically publish it.
+/// Concurrent broadcasts never wait on a slow subscriber or on registration changes.
+///
+/// Compared to `MulticastDelegateSafe`, a broadcast already in progress on another thread
+/// may still invoke a delegate after `Remove()` returns, since that broadcast uses the
+/// previous array. Delegates are stored by value in the array (see `DelegateValue`), so a
+/// broadcast does not chase a pointer per subscriber. Each registration change copies the
+/// array and each delegate; prefer this container when broadcasts are far more frequent
+/// than registration changes.
+///
+/// Broadcasts on different threads may invoke the same delegate instance concurrently.
+/// Synchronous and `DelegateAsync` delegates support this; `DelegateAsyncWait` stores 
+/// per-call results within the instance and must use `MulticastDelegateSafe` instead.
+
+#include "Delegate.h"
+#include "DelegateValue.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dmq {
+
+template <class R>
+struct MulticastDelegateSnapshot; // Not defined
+
+/// @brief Thread-safe copy-on-write multicast delegate container class.
+template<class RetType, class... Args>
+class MulticastDelegateSnapshot<RetType(Args...)>
+{
+public:
+    using DelegateType = Delegate<RetType(Args...)>;
+
+    MulticastDelegateSnapshot() = default;
+    ~MulticastDelegateSnapshot() = default;
+
+    MulticastDelegateSnapshot(const MulticastDelegateSnapshot& rhs) : m_delegates(rhs.Load()) { }
+
+    MulticastDelegateSnapshot& operator=(const MulticastDelegateSnapshot& rhs) {
+        if (&rhs != this) {
+            // Arrays are immutable, so the instances may share the same array
+            const std::lock_guard<std::mutex> lock(m_lock);
+            Store(rhs.Load());
+        }
+        return *this;
+    }
+
+    /// Invoke all bound target functions. Safe to insert or remove delegates during
+    /// invocation. A void return value is used since multiple targets invoked.
+    /// @param[in] args The arguments used when invoking the target functions
+    void operator()(Args... args) const {
+        // Hold the snapshot alive for the duration of the broadcast
+        auto delegates = Load();
+        if (!delegates)
+            return;
+        for (const auto& delegate : *delegates)
+            delegate(args...);
+    }
+
+    /// Invoke all bound target functions. A void return value is used
+    /// since multiple targets invoked.
+    /// @param[in] args The arguments used when invoking the target functions
+    void Broadcast(Args... args) const {
+        (*this)(args...);
+    }
+
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    void operator+=(const DelegateType& delegate) { PushBack(delegate); }
+
+    /// Remove a delegate from the container.
+    /// @param[in] delegate A delegate target to remove
+    void operator-=(const DelegateType& delegate) { Remove(delegate); }
+
+    /// @brief Clear the all target functions.
+    void operator=(std::nullptr_t) noexcept { Clear(); }
+
+    /// Insert a delegate into the container.
+    /// @param[in] delegate A delegate target to insert
+    /// @throws std::bad_alloc If dynamic memory allocation fails and DMQ_ASSERTS not defined.
+    void PushBack(const DelegateType& delegate) {
+        ValueType value(delegate);
+
+        const std::lock_guard<std::mutex> lock(m_lock);
+        auto current = Load();
+        auto next = std::make_shared<Array>();
+        next->reserve((current ? current->size() : 0) + 1);
+        if (current)
+            next->assign(current->begin(), current->end());
+        next->push_back(std::move(value));
+        Store(std::move(next));
+    }
+
+    /// Remove a delegate from the container.
+    /// @param[in] delegate The delegate target to remove.
+    void Remove(const DelegateType& delegate) {
+        const std::lock_guard<std::mutex> lock(m_lock);
+        auto current = Load();
+        if (!current)
+            return;
+
+        auto it = std::find_if(current->begin(), current->end(),
+            [&delegate](const ValueType& item) { return item == delegate; });
+        if (it == current->end())
+            return;
+
+        auto next = std::make_shared<Array>();
+        next->reserve(current->size() - 1);
+        next->insert(next->end(), current->begin(), it);
+        next->insert(next->end(), it + 1, current->end());
+        Store(next->empty() ? nullptr : std::move(next));
+    }
+
+    /// Any registered delegates?
+    /// @return `true` if delegate container is empty.
+    bool Empty() const { return Size() == 0; }
+
+    /// Removal all registered delegates.
+    void Clear() {
+        const std::lock_guard<std::mutex> lock(m_lock);
+        Store(nullptr);
+    }
+
+    /// Get the number of delegates stored.
+    /// @return The number of delegates stored.
+    std::size_t Size() const {
+        auto delegates = Load();
+        return delegates ? delegates->size() : 0;
+    }
+
+    /// @brief Implicit conversion operator to `bool`.
+    /// @return `true` if the container is not empty, `false` if the container is empty.
+    explicit operator bool() const { return !Empty(); }
+
+private:
+    using ValueType = DelegateValue<RetType(Args...)>;
+    using Array = std::vector<ValueType>;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::shared_ptr<const Array> Load() const { return m_delegates.load(); }
+    void Store(std::shared_ptr<const Array> delegates) { m_delegates.store(std::move(delegates)); }
+
+    /// Current immutable array of registered delegates, or nullptr if empty
+    std::atomic<std::shared_ptr<const Array>> m_delegates;
+#else
+    std::shared_ptr<const Array> Load() const { return std::atomic_load(&m_delegates); }
+    void Store(std::shared_ptr<const Array> delegates) { std::atomic_store(&m_delegates, std::move(delegates)); }
+
+    /// Current immutable array of registered delegates, or nullptr if empty.
+    /// Accessed only using atomic load and store.
+    std::shared_ptr<const Array> m_delegates;
+#endif
+
+    /// Lock serializing writers. Never taken by a broadcast.
+    std::mutex m_lock;
+};
+
+}
+
+#endif
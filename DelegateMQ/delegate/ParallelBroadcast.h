@@ -0,0 +1,239 @@
+#ifndef _PARALLEL_BROADCAST_H
+#define _PARALLEL_BROADCAST_H
+
+/// @file
+/// @brief Partition a broadcast across a pool of delegate worker threads.
+///
+/// @details `ParallelFor()` splits a range of subscriber positions into chunks. One chunk
+/// runs on the calling thread and each remaining chunk is dispatched to a worker `IThread`
+/// as a pooled message. The caller blocks until every chunk completes, so broadcast
+/// latency is bounded by the slowest chunk rather than the sum of all targets.
+///
+/// A chunk message signals completion from its destructor. If a worker discards the
+/// message without invoking it (e.g. the thread exited), the caller runs the chunk itself.
+/// An exception thrown by a target on a worker thread is rethrown on the calling thread.
+
+#include "IThread.h"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace dmq {
+
+/// @brief Completion state shared by the chunks of one parallel broadcast. Lives on
+/// the broadcasting thread stack.
+class BroadcastJoin
+{
+public:
+    /// Constructor
+    /// @param[in] count - the number of dispatched chunks to wait on.
+    explicit BroadcastJoin(int count) : m_count(count) {}
+
+    /// Signal one chunk complete
+    void CountDown() {
+        // Notify while locked; the waiter destroys this object once it returns
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (--m_count == 0)
+            m_cv.notify_all();
+    }
+
+    /// Wait for all dispatched chunks to complete
+    void Wait() {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_cv.wait(lock, [this] { return m_count == 0; });
+    }
+
+    /// Record the first exception thrown by a target function
+    /// @param[in] e - the exception.
+    void SetException(std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (!m_exception)
+            m_exception = e;
+    }
+
+    /// Get the first exception thrown by a target function, if any
+    std::exception_ptr GetException() {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_exception;
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_cv;
+    int m_count;
+    std::exception_ptr m_exception;
+};
+
+/// @brief A contiguous range of subscriber positions invoked by one thread
+struct BroadcastChunk
+{
+    /// Type erased range function and its context
+    void (*run)(void* ctx, std::size_t begin, std::size_t end) = nullptr;
+    void* ctx = nullptr;
+
+    std::size_t begin = 0;
+    std::size_t end = 0;
+
+    /// The join to signal, or nullptr if the chunk runs on the calling thread
+    BroadcastJoin* join = nullptr;
+
+    /// `true` once the range is invoked
+    bool executed = false;
+
+    /// Invoke the range. Exceptions are recorded in the join, if any.
+    void Run() {
+        try {
+            run(ctx, begin, end);
+        }
+        catch (...) {
+            executed = true;
+            if (!join)
+                throw;
+            join->SetException(std::current_exception());
+            return;
+        }
+        executed = true;
+    }
+};
+
+/// @brief Message that invokes one broadcast chunk on a worker thread.
+class BroadcastChunkMsg : public DelegateMsg
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the chunk invoker instance
+    /// @param[in] chunk - the chunk to invoke. Must outlive the message.
+    BroadcastChunkMsg(std::shared_ptr<IThreadInvoker> invoker, BroadcastChunk* chunk) :
+        DelegateMsg(std::move(invoker), Priority::HIGH, TypeIdOf<BroadcastChunkMsg>()),
+        m_chunk(chunk) {}
+
+    /// Signal completion whether or not the chunk was invoked
+    ~BroadcastChunkMsg() override { m_chunk->join->CountDown(); }
+
+    BroadcastChunk* GetChunk() const noexcept { return m_chunk; }
+
+private:
+    BroadcastChunk* m_chunk;
+};
+
+/// @brief Invoker shared by all broadcast chunk messages
+class BroadcastChunkInvoker : public IThreadInvoker
+{
+public:
+    /// Get the shared instance using the "Immortal" Pattern. Chunk messages may
+    /// be destroyed after static destructors run.
+    static const std::shared_ptr<IThreadInvoker>& GetInstance() {
+        static auto* instance = new std::shared_ptr<IThreadInvoker>(new BroadcastChunkInvoker());
+        return *instance;
+    }
+
+    /// Invoke the chunk. Called by the worker thread.
+    virtual bool Invoke(DelegateMsg& msg) override {
+        auto chunkMsg = MsgCast<BroadcastChunkMsg>(msg);
+        if (chunkMsg == nullptr)
+            return false;
+        chunkMsg->GetChunk()->Run();
+        return true;
+    }
+};
+
+/// Maximum number of chunks per parallel broadcast. Additional workers are unused.
+constexpr std::size_t MAX_BROADCAST_CHUNKS = 64;
+
+/// Invoke `func(begin, end)` over the range [0, count) split across the calling thread
+/// and the worker threads. Returns once all chunks complete.
+/// @param[in] workers - the worker threads. A null entry or the calling thread is skipped.
+/// @param[in] count - the range size.
+/// @param[in] func - the range function. Called concurrently from several threads.
+/// @throws Rethrows the first exception thrown by `func`.
+template <class F>
+void ParallelFor(const std::vector<IThread*>& workers, std::size_t count, F& func)
+{
+    auto run = [](void* ctx, std::size_t begin, std::size_t end) { (*static_cast<F*>(ctx))(begin, end); };
+
+    // Usable workers; the calling thread runs the first chunk
+    IThread* threads[MAX_BROADCAST_CHUNKS - 1];
+    std::size_t numThreads = 0;
+    for (IThread* worker : workers) {
+        if (numThreads == MAX_BROADCAST_CHUNKS - 1)
+            break;
+        if (worker && !worker->IsCurrentThread())
+            threads[numThreads++] = worker;
+    }
+
+    std::size_t numChunks = (std::min)(numThreads + 1, count);
+    if (numChunks <= 1) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    BroadcastChunk chunks[MAX_BROADCAST_CHUNKS];
+    BroadcastJoin join(static_cast<int>(numChunks - 1));
+    std::size_t chunkSize = count / numChunks;
+    std::size_t remainder = count % numChunks;
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < numChunks; i++) {
+        BroadcastChunk& chunk = chunks[i];
+        chunk.run = run;
+        chunk.ctx = &func;
+        chunk.begin = begin;
+        chunk.end = begin + chunkSize + (i < remainder ? 1 : 0);
+        begin = chunk.end;
+    }
+
+    // Dispatch chunks 1..n to the workers
+    for (std::size_t i = 1; i < numChunks; i++) {
+        chunks[i].join = &join;
+        MsgPtr<BroadcastChunkMsg> msg;
+        try {
+            msg = MakeMsg<BroadcastChunkMsg>(BroadcastChunkInvoker::GetInstance(), &chunks[i]);
+        }
+        catch (const std::bad_alloc&) {
+            // No message; count down here and run the chunk below
+            join.CountDown();
+            continue;
+        }
+
+        try {
+            threads[i - 1]->DispatchDelegate(std::move(msg));
+        }
+        catch (...) {
+            // The destroyed message counted down; the chunk runs below
+        }
+    }
+
+    // Run chunk 0 on the calling thread, then join
+    std::exception_ptr localException;
+    try {
+        chunks[0].Run();
+    }
+    catch (...) {
+        localException = std::current_exception();
+    }
+    join.Wait();
+
+    // Run any chunk a worker discarded without invoking
+    for (std::size_t i = 1; i < numChunks; i++) {
+        if (!chunks[i].executed) {
+            chunks[i].join = nullptr;
+            try {
+                chunks[i].Run();
+            }
+            catch (...) {
+                if (!localException)
+                    localException = std::current_exception();
+            }
+        }
+    }
+
+    if (localException)
+        std::rethrow_exception(localException);
+    if (auto e = join.GetException())
+        std::rethrow_exception(e);
+}
+
+}
+
+#endif
@@ -2,73 +2,165 @@
 #define _DELEGATE_SEMAPHORE_H
 
 /// @file
-/// @brief Delegate library semaphore wrapper class. 
+/// @brief Delegate library semaphore wrapper class.
+///
+/// @details The semaphore is adaptive. `Wait()` first spins briefly, since a blocking
+/// delegate target function often completes within microseconds, then parks the thread.
+/// On Linux the thread parks on a futex; other platforms use a condition variable.
+/// `Signal()` makes a system call only if a thread is parked.
 
 #include "DelegateOpt.h"
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <climits>
+    #include <ctime>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <intrin.h>
+#endif
+
 // Fix compiler error on Windows
 #undef max
 
 namespace dmq {
 
-/// @brief A semaphore wrapper class. 
+/// @brief A binary semaphore wrapper class.
 class Semaphore
 {
 public:
+	/// Number of polls before parking the waiting thread
+	static constexpr int SPIN_COUNT = 200;
+
 	Semaphore() = default;
 	~Semaphore() = default;
 
 	/// Called to wait on a semaphore to be signaled.
-	/// @param[in] timeout - semaphore timeout 
-	/// @return Return true if semaphore signaled, false if timeout occurred. 
+	/// @param[in] timeout - semaphore timeout
+	/// @return Return true if semaphore signaled, false if timeout occurred.
 	bool Wait(Duration timeout)
 	{
-        std::unique_lock<std::mutex> lk(m_lock);
-        if (timeout == Duration::max())
-        {
-            m_sema.wait(lk, [this] { return m_signaled; });
-        }
-        else
-        {
-            if (!m_sema.wait_for(lk, timeout, [this] { return m_signaled; }))
-            {
-                return false; // Timeout occurred
-            }
-        }
-
-        if (m_signaled)
-        {
-            m_signaled = false;
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+		for (int spin = 0; spin < SPIN_COUNT; spin++)
+		{
+			if (TryAcquire())
+				return true;
+			CpuRelax();
+		}
+
+		const bool infinite = (timeout == Duration::max());
+		const auto deadline = infinite ? Clock::time_point::max() : Clock::now() + timeout;
+
+		while (!TryAcquire())
+		{
+			Clock::duration remaining = Clock::duration::max();
+			if (!infinite)
+			{
+				remaining = deadline - Clock::now();
+				if (remaining <= Clock::duration::zero())
+					return false; // Timeout occurred
+			}
+
+			m_waiters.fetch_add(1);
+			Park(remaining, infinite);
+			m_waiters.fetch_sub(1);
+		}
+		return true;
 	}
 
 	/// Called to signal a semaphore.
-    void Signal()
-    {
-        {
-            std::unique_lock<std::mutex> lk(m_lock);
-            m_signaled = true;
-        }
-        m_sema.notify_one();
-    }
+	void Signal()
+	{
+		m_signaled.store(1);
+		if (m_waiters.load() > 0)
+			Unpark();
+	}
 
 private:
 	// Prevent copying objects
 	Semaphore(const Semaphore&) = delete;
 	Semaphore& operator=(const Semaphore&) = delete;
 
+	/// Consume the signal, if set
+	bool TryAcquire()
+	{
+		int expected = 1;
+		return m_signaled.load(std::memory_order_relaxed) == 1 &&
+			m_signaled.compare_exchange_strong(expected, 0, std::memory_order_acquire);
+	}
+
+	/// Hint to the CPU that the thread is spinning
+	static void CpuRelax()
+	{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		__asm__ __volatile__("yield");
+#endif
+	}
+
+#if defined(__linux__)
+	static_assert(sizeof(std::atomic<int>) == sizeof(int), "Futex requires a plain int atomic");
+
+	/// Block while the semaphore is not signaled. May return early.
+	void Park(Clock::duration remaining, bool infinite)
+	{
+		struct timespec ts;
+		struct timespec* pts = nullptr;
+		if (!infinite)
+		{
+			auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+			ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+			ts.tv_nsec = static_cast<long>(ns % 1000000000);
+			pts = &ts;
+		}
+		syscall(SYS_futex, reinterpret_cast<int*>(&m_signaled), FUTEX_WAIT_PRIVATE, 0, pts, nullptr, 0);
+	}
+
+	/// Wake a parked thread
+	void Unpark()
+	{
+		syscall(SYS_futex, reinterpret_cast<int*>(&m_signaled), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+	}
+#else
+	/// Block while the semaphore is not signaled. May return early.
+	void Park(Clock::duration remaining, bool infinite)
+	{
+		std::unique_lock<std::mutex> lk(m_lock);
+		if (infinite)
+			m_sema.wait(lk, [this] { return m_signaled.load() == 1; });
+		else
+			m_sema.wait_for(lk, remaining, [this] { return m_signaled.load() == 1; });
+	}
+
+	/// Wake a parked thread
+	void Unpark()
+	{
+		// Lock orders the notify after a waiter checks the predicate
+		{
+			std::lock_guard<std::mutex> lk(m_lock);
+		}
+		m_sema.notify_all();
+	}
+
 	std::condition_variable m_sema;
 	std::mutex m_lock;
-	bool m_signaled = false;
+#endif
+
+	/// 1 if signaled, 0 otherwise
+	std::atomic<int> m_signaled = 0;
+
+	/// Number of threads parked or about to park
+	std::atomic<int> m_waiters = 0;
 };
 
 }
 
-#endif 
+#endif
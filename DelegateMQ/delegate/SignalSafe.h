@@ -8,13 +8,17 @@
 /// multicast delegates to return `Connection` handles upon subscription. These handles can be
 /// wrapped in `ScopedConnection` to automatically unsubscribe when the handle goes out of scope.
 ///
+/// A `Connection` is a compact token: a weak handle to the signal plus the slot identifier
+/// returned by `PushBackSlot()`. Connecting and disconnecting do not allocate beyond the
+/// signal's own storage.
+///
 /// @note Signals **MUST** be instantiated via `std::make_shared` (or `dmq::MakeSignal`). 
 /// Instantiating them on the stack will cause a runtime crash (std::bad_weak_ptr) when 
 /// `Connect()` is called.
 
 #include "MulticastDelegate.h"
 #include "MulticastDelegateSafe.h"
-#include <functional>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <cassert>
@@ -22,19 +26,24 @@
 namespace dmq {
 
     // --- Connection Handle Classes ---
-    // (Connection and ScopedConnection classes remain unchanged)
 
     /// @brief Represents a unique handle to a delegate connection. 
     /// Move-only to prevent double-disconnection bugs.
     class Connection {
     public:
+        /// Removes slot `id` from the signal `watcher` refers to
+        using DisconnectFunc = void (*)(const std::shared_ptr<void>& watcher, std::uint64_t id);
+
         Connection() = default;
 
-        template<typename DisconnectFunc>
-        Connection(std::weak_ptr<void> watcher, DisconnectFunc&& func)
-            : m_watcher(watcher)
-            , m_disconnect(std::forward<DisconnectFunc>(func))
-            , m_connected(true)
+        /// Constructor
+        /// @param[in] watcher A weak handle to the signal.
+        /// @param[in] func The function that removes the slot from the signal.
+        /// @param[in] id The slot identifier.
+        Connection(std::weak_ptr<void> watcher, DisconnectFunc func, std::uint64_t id) noexcept
+            : m_watcher(std::move(watcher))
+            , m_disconnect(func)
+            , m_id(id)
         {
         }
 
@@ -43,10 +52,9 @@ namespace dmq {
 
         Connection(Connection&& other) noexcept
             : m_watcher(std::move(other.m_watcher))
-            , m_disconnect(std::move(other.m_disconnect))
-            , m_connected(other.m_connected)
+            , m_disconnect(other.m_disconnect)
+            , m_id(other.m_id)
         {
-            other.m_connected = false;
             other.m_disconnect = nullptr;
         }
 
@@ -54,9 +62,8 @@ namespace dmq {
             if (this != &other) {
                 Disconnect();
                 m_watcher = std::move(other.m_watcher);
-                m_disconnect = std::move(other.m_disconnect);
-                m_connected = other.m_connected;
-                other.m_connected = false;
+                m_disconnect = other.m_disconnect;
+                m_id = other.m_id;
                 other.m_disconnect = nullptr;
             }
             return *this;
@@ -65,25 +72,22 @@ namespace dmq {
         ~Connection() {}
 
         bool IsConnected() const {
-            return m_connected && !m_watcher.expired();
+            return m_disconnect && !m_watcher.expired();
         }
 
         void Disconnect() {
-            if (!m_connected) return;
-            if (!m_watcher.expired()) {
-                if (m_disconnect) {
-                    m_disconnect();
-                }
+            if (!m_disconnect) return;
+            if (auto watcher = m_watcher.lock()) {
+                m_disconnect(watcher, m_id);
             }
             m_disconnect = nullptr;
             m_watcher.reset();
-            m_connected = false;
         }
 
     private:
         std::weak_ptr<void> m_watcher;
-        std::function<void()> m_disconnect;
-        bool m_connected = false;
+        DisconnectFunc m_disconnect = nullptr;
+        std::uint64_t m_id = 0;
     };
 
     /// @brief RAII wrapper for Connection. Automatically disconnects when it goes out of scope.
@@ -127,6 +131,7 @@ namespace dmq {
     public:
         using BaseType = MulticastDelegate<RetType(Args...)>;
         using DelegateType = Delegate<RetType(Args...)>;
+        using ClassType = Signal<RetType(Args...)>;
 
         Signal() = default;
         Signal(const Signal&) = delete;
@@ -147,20 +152,19 @@ namespace dmq {
                 throw;
             }
 
-            this->PushBack(delegate);
-
-            std::shared_ptr<DelegateType> delegateCopy(delegate.Clone());
-
-            return Connection(weakSelf, [weakSelf, delegateCopy]() {
-                if (auto self = weakSelf.lock()) {
-                    self->Remove(*delegateCopy);
-                }
-                });
+            auto id = this->PushBackSlot(delegate);
+            return Connection(std::move(weakSelf), &Signal::DisconnectSlot, id);
         }
 
         void operator+=(const DelegateType& delegate) {
             this->PushBack(delegate);
         }
+
+    private:
+        /// Connection disconnect function
+        static void DisconnectSlot(const std::shared_ptr<void>& watcher, std::uint64_t id) {
+            static_cast<ClassType*>(watcher.get())->RemoveSlot(id);
+        }
     };
 
 
@@ -177,6 +181,7 @@ namespace dmq {
     public:
         using BaseType = MulticastDelegateSafe<RetType(Args...)>;
         using DelegateType = Delegate<RetType(Args...)>;
+        using ClassType = SignalSafe<RetType(Args...)>;
 
         SignalSafe() = default;
         SignalSafe(const SignalSafe&) = delete;
@@ -197,20 +202,19 @@ namespace dmq {
                 throw;
             }
 
-            this->PushBack(delegate);
-
-            std::shared_ptr<DelegateType> delegateCopy(delegate.Clone());
-
-            return Connection(weakSelf, [weakSelf, delegateCopy]() {
-                if (auto self = weakSelf.lock()) {
-                    self->Remove(*delegateCopy);
-                }
-                });
+            auto id = this->PushBackSlot(delegate);
+            return Connection(std::move(weakSelf), &SignalSafe::DisconnectSlot, id);
         }
 
         void operator+=(const DelegateType& delegate) {
             this->PushBack(delegate);
         }
+
+    private:
+        /// Connection disconnect function
+        static void DisconnectSlot(const std::shared_ptr<void>& watcher, std::uint64_t id) {
+            static_cast<ClassType*>(watcher.get())->RemoveSlot(id);
+        }
     };
 
     // Alias for the shared_ptr type
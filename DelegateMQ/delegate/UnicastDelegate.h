@@ -5,8 +5,7 @@
 /// @brief Delegate container for storing an invoking a single delegate instance. 
 /// Class is not thread-safe.
 
-#include "Delegate.h"
-#include <memory>
+#include "DelegateValue.h"
 
 namespace dmq {
 
@@ -29,13 +28,7 @@ public:
     /// provided `rhs` (right-hand side) object. The `rhs` object is used to 
     /// set the state of the new instance.
     /// @param[in] rhs The object to copy from.
-    UnicastDelegate(const UnicastDelegate& rhs) {
-        if (rhs.m_delegate) {
-            auto delegateClone = rhs.m_delegate->Clone();
-            if (!delegateClone) BAD_ALLOC();
-            m_delegate = std::shared_ptr<DelegateType>(delegateClone);
-        }
-    }
+    UnicastDelegate(const UnicastDelegate& rhs) : m_delegate(rhs.m_delegate) { }
 
     /// @brief Move constructor that transfers ownership of resources.
     /// @param[in] rhs The object to move from.
@@ -46,7 +39,7 @@ public:
     /// @return The target function return value. 
     RetType operator()(Args... args) {
         if (m_delegate)
-            return (*m_delegate)(args...);	// Invoke delegate callback
+            return m_delegate(args...);	// Invoke delegate callback
         else
             return RetType();
     }
@@ -60,17 +53,13 @@ public:
     /// Assign a delegate to the container.
     /// @param[in] rhs A delegate target to assign
     void operator=(const DelegateType& rhs) {
-        auto delegateClone = rhs.Clone();
-        if (!delegateClone) BAD_ALLOC();
-        m_delegate = std::shared_ptr<DelegateType>(delegateClone);
+        m_delegate = rhs;
     }
 
     /// Assign a delegate to the container.
     /// @param[in] rhs A delegate target to assign
     void operator=(DelegateType&& rhs) {
-        auto delegateClone = rhs.Clone();
-        if (!delegateClone) BAD_ALLOC();
-        m_delegate = std::shared_ptr<DelegateType>(delegateClone);
+        m_delegate = rhs;
     }
 
     /// @brief Assignment operator that assigns the state of one object to another.
@@ -78,14 +67,7 @@ public:
     /// @return A reference to the current object.
     UnicastDelegate& operator=(const UnicastDelegate& rhs) {
         if (this != &rhs) {
-            if (rhs.m_delegate) {
-                auto delegateClone = rhs.m_delegate->Clone();
-                if (!delegateClone) BAD_ALLOC();
-                m_delegate = std::shared_ptr<DelegateType>(delegateClone);
-            }
-            else {
-                m_delegate = nullptr;
-            }
+            m_delegate = rhs.m_delegate;
         }
         return *this;
     }
@@ -112,15 +94,15 @@ public:
 
     /// Get the number of delegates stored.
     /// @return The number of delegates stored.
-    std::size_t Size() const { return m_delegate == nullptr ? 0 : 1; }
+    std::size_t Size() const { return m_delegate.Empty() ? 0 : 1; }
 
     /// @brief Implicit conversion operator to `bool`.
     /// @return `true` if the container is not empty, `false` if the container is empty.
     explicit operator bool() const { return !Empty(); }
 
 private:
-    /// Registered delegate.
-    std::shared_ptr<DelegateType> m_delegate = nullptr;
+    /// Registered delegate stored by value.
+    DelegateValue<RetType(Args...)> m_delegate;
 };
 
 }
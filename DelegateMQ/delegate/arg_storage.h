@@ -0,0 +1,128 @@
+#ifndef _ARG_STORAGE_H
+#define _ARG_STORAGE_H
+
+// @see https://github.com/endurodave/DelegateMQ
+
+/// @file
+/// @brief Helper classes for storing copies of function arguments inline within an
+/// asynchronous delegate message.
+///
+/// @details `arg_storage<T>` holds a copy of one function argument of type `T`. A
+/// `std::tuple<arg_storage<Args>...>` member stores all arguments within the message
+/// object itself, so the arguments require no memory allocation beyond the message.
+/// The copies are constructed when the message is created and destroyed with the
+/// message. It supports all types of function arguments, including by value,
+/// pointer, pointer-to-pointer, and reference.
+///
+/// `get()` returns the argument in the form the target function expects:
+///
+/// * `T` - moves the stored value out. Move-only types (e.g. `std::unique_ptr`) are supported.
+/// * `T&&` - moves the stored value out.
+/// * `T&` - returns a reference to the stored copy.
+/// * `T*` - returns a pointer to the stored copy, or `nullptr` if the source pointer was `nullptr`.
+/// * `T**` - returns a pointer to a pointer to the stored copy. The inner pointer is `nullptr`
+/// if the source pointer or pointee was `nullptr`.
+///
+/// By value and rvalue reference arguments are moved into the storage when possible, 
+/// so `get()` must be called only once. The storage objects reference themselves and 
+/// cannot be copied or moved.
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace dmq
+{
+/// @brief Stores a by value argument
+template <typename T>
+class arg_storage
+{
+public:
+    template <typename U>
+    explicit arg_storage(U&& arg) : m_arg(std::forward<U>(arg)) {}
+
+    arg_storage(const arg_storage&) = delete;
+    arg_storage& operator=(const arg_storage&) = delete;
+
+    T&& get() { return std::move(m_arg); }
+
+private:
+    T m_arg;
+};
+
+/// @brief Stores an rvalue reference argument
+template <typename T>
+class arg_storage<T&&>
+{
+public:
+    explicit arg_storage(T&& arg) : m_arg(std::move(arg)) {}
+
+    arg_storage(const arg_storage&) = delete;
+    arg_storage& operator=(const arg_storage&) = delete;
+
+    T&& get() { return std::move(m_arg); }
+
+private:
+    std::remove_const_t<T> m_arg;
+};
+
+/// @brief Stores a copy of a reference argument
+template <typename T>
+class arg_storage<T&>
+{
+public:
+    explicit arg_storage(T& arg) : m_arg(arg) {}
+
+    arg_storage(const arg_storage&) = delete;
+    arg_storage& operator=(const arg_storage&) = delete;
+
+    T& get() { return m_arg; }
+
+private:
+    std::remove_const_t<T> m_arg;
+};
+
+/// @brief Stores a copy of a pointer argument pointee
+template <typename T>
+class arg_storage<T*>
+{
+public:
+    explicit arg_storage(T* arg) {
+        if (arg != nullptr)
+            m_arg.emplace(*arg);
+    }
+
+    arg_storage(const arg_storage&) = delete;
+    arg_storage& operator=(const arg_storage&) = delete;
+
+    T* get() { return m_arg ? &m_arg.value() : nullptr; }
+
+private:
+    std::optional<std::remove_const_t<T>> m_arg;
+};
+
+/// @brief Stores a copy of a pointer to pointer argument pointee
+template <typename T>
+class arg_storage<T**>
+{
+public:
+    explicit arg_storage(T** arg) {
+        if (arg != nullptr && *arg != nullptr) {
+            m_arg.emplace(**arg);
+            m_ptr = &m_arg.value();
+        }
+    }
+
+    arg_storage(const arg_storage&) = delete;
+    arg_storage& operator=(const arg_storage&) = delete;
+
+    T** get() { return &m_ptr; }
+
+private:
+    std::optional<std::remove_const_t<T>> m_arg;
+    T* m_ptr = nullptr;
+};
+
+}
+
+#endif
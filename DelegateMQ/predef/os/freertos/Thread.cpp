@@ -64,16 +64,24 @@ TaskHandle_t Thread::GetCurrentThreadId()
 	return xTaskGetCurrentTaskHandle();
 }
 
+//----------------------------------------------------------------------------
+// IsCurrentThread
+//----------------------------------------------------------------------------
+bool Thread::IsCurrentThread() const
+{
+	return m_thread != nullptr && m_thread == xTaskGetCurrentTaskHandle();
+}
+
 //----------------------------------------------------------------------------
 // DispatchDelegate
 //----------------------------------------------------------------------------
-void Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
+void Thread::DispatchDelegate(dmq::DelegateMsgPtr msg)
 {
 	if (m_queue == nullptr)
 		throw std::invalid_argument("Queue pointer is null");
 
 	// Create a new ThreadMsg
-	ThreadMsg* threadMsg = new ThreadMsg(MSG_DISPATCH_DELEGATE, msg);
+	ThreadMsg* threadMsg = new ThreadMsg(MSG_DISPATCH_DELEGATE, std::move(msg));
 	if (xQueueSend(m_queue, &threadMsg, portMAX_DELAY) != pdPASS)
 	{
 		// Handle the case when the message was not successfully added to the queue
@@ -108,8 +116,17 @@ void Thread::Process(void* instance)
 					auto invoker = delegateMsg->GetInvoker();
 					ASSERT_TRUE(invoker);
 
+					// Discard stale messages that missed their deadline. The queue
+					// is first-in first-out, so an expired message is only dropped
+					// once it reaches the front.
+					if (delegateMsg->IsExpired(Clock::now()))
+					{
+						delete msg;
+						break;
+					}
+
 					// Invoke the delegate destination target function
-					bool success = invoker->Invoke(delegateMsg);
+					bool success = invoker->Invoke(*delegateMsg);
 					ASSERT_TRUE(success);
 
 					delete msg;
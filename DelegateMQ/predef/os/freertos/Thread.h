@@ -42,7 +42,10 @@ public:
 	/// Get thread name
 	std::string GetThreadName() { return THREAD_NAME; }
 
-	virtual void DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg);
+	virtual void DispatchDelegate(dmq::DelegateMsgPtr msg);
+
+	/// Check if the caller is executing on this thread
+	virtual bool IsCurrentThread() const;
 
 private:
 	Thread(const Thread&) = delete;
@@ -13,18 +13,18 @@ public:
 	/// @pre The data pointer argument *must* be created on the heap.
 	/// @post The destination thread will delete the heap allocated data once the 
 	///		callback is complete.  
-	ThreadMsg(int id, std::shared_ptr<dmq::DelegateMsg> data) :
+	ThreadMsg(int id, dmq::DelegateMsgPtr data) :
 		m_id(id), 
-		m_data(data)
+		m_data(std::move(data))
 	{
 	}
 
 	int GetId() const { return m_id; } 
-    std::shared_ptr<dmq::DelegateMsg> GetData() { return m_data; }
+    dmq::DelegateMsg* GetData() { return m_data.get(); }
 
 private:
 	int m_id;
-    std::shared_ptr<dmq::DelegateMsg> m_data;
+    dmq::DelegateMsgPtr m_data;
 
 	// Use fixed-block memory allocator if DMQ_ALLOCATOR set
 	XALLOCATOR
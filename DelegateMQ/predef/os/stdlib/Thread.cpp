@@ -4,6 +4,14 @@
 
 #ifdef _WIN32
 #include <Windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
 #endif
 
 using namespace std;
@@ -32,19 +40,34 @@ Thread::~Thread()
 //----------------------------------------------------------------------------
 bool Thread::CreateThread(std::optional<dmq::Duration> watchdogTimeout)
 {
+    ThreadOptions options;
+    options.watchdogTimeout = watchdogTimeout;
+    return CreateThread(options);
+}
+
+//----------------------------------------------------------------------------
+// CreateThread
+//----------------------------------------------------------------------------
+bool Thread::CreateThread(const ThreadOptions& options)
+{
+    bool success = true;
     if (!m_thread)
     {
-        m_threadStartPromise = std::promise<void>();
+        m_options = options;
+        auto watchdogTimeout = options.watchdogTimeout;
+
+        m_threadStartPromise = std::promise<bool>();
         m_threadStartFuture = m_threadStartPromise.get_future();
         m_exit = false;
+        m_stalled = false;
 
         m_thread = std::unique_ptr<std::thread>(new thread(&Thread::Process, this));
 
         auto handle = m_thread->native_handle();
         SetThreadName(handle, THREAD_NAME);
 
-        // Wait for the thread to enter the Process method
-        m_threadStartFuture.get();
+        // Wait for the thread to enter the Process method and apply options
+        success = m_threadStartFuture.get();
 
         m_lastAliveTime.store(Timer::GetNow());
 
@@ -69,7 +92,7 @@ bool Thread::CreateThread(std::optional<dmq::Duration> watchdogTimeout)
 
         LOG_INFO("Thread::CreateThread {}", THREAD_NAME);
     }
-    return true;
+    return success;
 }
 
 //----------------------------------------------------------------------------
@@ -96,8 +119,7 @@ std::thread::id Thread::GetCurrentThreadId()
 //----------------------------------------------------------------------------
 size_t Thread::GetQueueSize()
 {
-    lock_guard<mutex> lock(m_mutex);
-    return m_queue.size();
+    return m_stats.GetQueueDepth();
 }
 
 //----------------------------------------------------------------------------
@@ -113,9 +135,95 @@ void Thread::SetThreadName(std::thread::native_handle_type handle, const std::st
     {
         // Handle error if needed
     }
+#elif defined(__linux__)
+    // Linux limits thread names to 15 characters plus the null terminator
+    int err = pthread_setname_np(handle, name.substr(0, 15).c_str());
+    if (err != 0)
+        LOG_ERROR("Thread::SetThreadName failed {} {}", name, strerror(err));
 #endif
 }
 
+//----------------------------------------------------------------------------
+// ApplyThreadOptions
+//----------------------------------------------------------------------------
+bool Thread::ApplyThreadOptions()
+{
+    bool success = true;
+
+#ifdef _WIN32
+    HANDLE handle = GetCurrentThread();
+
+    if (!m_options.cpuAffinity.empty())
+    {
+        DWORD_PTR mask = 0;
+        for (int cpu : m_options.cpuAffinity)
+        {
+            if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+                mask |= (DWORD_PTR(1) << cpu);
+        }
+        if (mask == 0 || SetThreadAffinityMask(handle, mask) == 0)
+        {
+            LOG_ERROR("Thread::ApplyThreadOptions affinity failed {}", THREAD_NAME);
+            success = false;
+        }
+    }
+
+    if (m_options.priority != 0)
+    {
+        if (!SetThreadPriority(handle, m_options.priority))
+        {
+            LOG_ERROR("Thread::ApplyThreadOptions priority failed {}", THREAD_NAME);
+            success = false;
+        }
+    }
+#elif defined(__linux__)
+    pthread_t handle = pthread_self();
+
+    if (!m_options.cpuAffinity.empty())
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (int cpu : m_options.cpuAffinity)
+        {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &cpuSet);
+        }
+        int err = pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet);
+        if (err != 0)
+        {
+            LOG_ERROR("Thread::ApplyThreadOptions affinity failed {} {}", THREAD_NAME, strerror(err));
+            success = false;
+        }
+    }
+
+    if (m_options.policy != ThreadOptions::Policy::DEFAULT)
+    {
+        int policy = (m_options.policy == ThreadOptions::Policy::FIFO) ? SCHED_FIFO : SCHED_RR;
+        sched_param param{};
+        param.sched_priority = m_options.priority;
+        int err = pthread_setschedparam(handle, policy, &param);
+        if (err != 0)
+        {
+            LOG_ERROR("Thread::ApplyThreadOptions policy failed {} {}", THREAD_NAME, strerror(err));
+            success = false;
+        }
+    }
+
+    if (m_options.niceLevel.has_value())
+    {
+        // Linux applies the nice level per thread using the kernel thread ID
+        pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), m_options.niceLevel.value()) != 0)
+        {
+            LOG_ERROR("Thread::ApplyThreadOptions nice failed {} {}", THREAD_NAME, strerror(errno));
+            success = false;
+        }
+    }
+#endif
+
+    return success;
+}
+
 //----------------------------------------------------------------------------
 // ExitThread
 //----------------------------------------------------------------------------
@@ -137,12 +245,14 @@ void Thread::ExitThread()
     }
 
     // Create a new ThreadMsg
-    std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_EXIT_THREAD, 0));
+    ThreadMsg threadMsg(MSG_EXIT_THREAD, nullptr);
 
     // Put exit thread message into the queue
     {
         lock_guard<mutex> lock(m_mutex);
-        m_queue.push(threadMsg);
+        threadMsg.SetSequence(m_sequence++);
+        m_queue.push_back(std::move(threadMsg));
+        std::push_heap(m_queue.begin(), m_queue.end(), ThreadMsgComparator());
         m_cv.notify_one();
     }
 
@@ -165,8 +275,8 @@ void Thread::ExitThread()
     {
         lock_guard<mutex> lock(m_mutex);
         m_thread = nullptr;
-        while (!m_queue.empty())
-            m_queue.pop();
+        m_queue.clear();
+        m_stats.RecordQueueClear();
     }
 
     LOG_INFO("Thread::ExitThread {}", THREAD_NAME);
@@ -175,24 +285,27 @@ void Thread::ExitThread()
 //----------------------------------------------------------------------------
 // DispatchDelegate
 //----------------------------------------------------------------------------
-void Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
+void Thread::DispatchDelegate(dmq::DelegateMsgPtr msg)
 {
     if (m_exit.load())
         return;
     if (m_thread == nullptr)
         throw std::invalid_argument("Thread pointer is null");
 
-    // If using XALLOCATOR explicit operator new required. See xallocator.h.
-    std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_DISPATCH_DELEGATE, msg));
+    LOG_INFO("Thread::DispatchDelegate\n   thread={}\n   target={}", 
+        THREAD_NAME, 
+        msg->GetTargetType().name());
+
+    ThreadMsg threadMsg(MSG_DISPATCH_DELEGATE, std::move(msg));
+    auto priority = threadMsg.GetPriority();
 
     // Add dispatch delegate msg to queue and notify worker thread
     std::unique_lock<std::mutex> lk(m_mutex);
-    m_queue.push(threadMsg);
+    threadMsg.SetSequence(m_sequence++);
+    m_queue.push_back(std::move(threadMsg));
+    std::push_heap(m_queue.begin(), m_queue.end(), ThreadMsgComparator());
+    m_stats.RecordEnqueue(priority, m_queue.size());
     m_cv.notify_one();
-
-    LOG_INFO("Thread::DispatchDelegate\n   thread={}\n   target={}", 
-        THREAD_NAME, 
-        typeid(*threadMsg->GetData()->GetInvoker()).name());
 }
 
 //----------------------------------------------------------------------------
@@ -208,11 +321,72 @@ void Thread::WatchdogCheck()
     // Watchdog expired?
     if (delta > m_watchdogTimeout.load())
     {
-        LOG_ERROR("Watchdog detected unresponsive thread: {}", THREAD_NAME);
+        // Only report once per stall
+        if (m_stalled.exchange(true))
+            return;
+
+        ThreadStallInfo info;
+        info.threadName = THREAD_NAME;
+        info.stallTime = std::chrono::duration_cast<Duration>(delta);
+        info.queueSize = GetQueueSize();
+
+        auto target = m_currentTarget.load(memory_order_acquire);
+        if (target)
+        {
+            info.target = target->name();
+            info.invokeTime = std::chrono::duration_cast<Duration>(now - m_invokeStartTime.load());
+        }
+
+        LOG_ERROR("Watchdog detected unresponsive thread: {} target={} invokeTime={}ms queueSize={}", 
+            THREAD_NAME, 
+            info.target ? info.target : "none", 
+            info.invokeTime.count(), 
+            info.queueSize);
+
+        StallDetected(info);
+
+        if (m_watchdogAction.load() == WatchdogAction::ABORT)
+        {
+            DumpQueue();
+            ASSERT();
+        }
+    }
+    else if (m_stalled.exchange(false))
+    {
+        LOG_INFO("Watchdog thread recovered: {}", THREAD_NAME);
+    }
+}
 
-        // @TODO Optionally trigger recovery, restart, or further actions here
-        // For example, throw or notify external system
+//----------------------------------------------------------------------------
+// DumpQueue
+//----------------------------------------------------------------------------
+void Thread::DumpQueue()
+{
+#ifdef DMQ_LOG
+    // Never block the watchdog on the queue lock
+    std::unique_lock<std::mutex> lk(m_mutex, std::try_to_lock);
+    if (!lk.owns_lock())
+    {
+        LOG_ERROR("Thread::DumpQueue {} queue locked", THREAD_NAME);
+        return;
     }
+    // Collect in priority order without copying the queued messages
+    std::vector<const ThreadMsg*> queue;
+    for (const auto& msg : m_queue)
+        queue.push_back(&msg);
+    std::sort(queue.begin(), queue.end(), [](const ThreadMsg* a, const ThreadMsg* b) {
+        return ThreadMsgComparator()(*b, *a);
+    });
+
+    LOG_ERROR("Thread::DumpQueue {} size={}", THREAD_NAME, queue.size());
+    for (const ThreadMsg* msg : queue)
+    {
+        LOG_ERROR("   id={} priority={} target={}", 
+            msg->GetId(), 
+            static_cast<int>(msg->GetPriority()),
+            msg->GetData() ? msg->GetData()->GetTargetType().name() : "none");
+    }
+#endif
 }
 
 //----------------------------------------------------------------------------
@@ -230,8 +404,12 @@ void Thread::ThreadCheck()
 //----------------------------------------------------------------------------
 void Thread::Process()
 {
-    // Signal that the thread has started processing to notify CreateThread
-    m_threadStartPromise.set_value();
+    // Apply options on this thread, then signal that the thread has started 
+    // processing to notify CreateThread
+    m_threadStartPromise.set_value(ApplyThreadOptions());
+
+    // Register for IThread::GetCurrent()
+    SetCurrent();
 
     LOG_INFO("Thread::Process Start {}", THREAD_NAME);
 
@@ -239,7 +417,7 @@ void Thread::Process()
     {
         m_lastAliveTime.store(Timer::GetNow());
 
-        std::shared_ptr<ThreadMsg> msg;
+        std::optional<ThreadMsg> msg;
         {
             // Wait for a message to be added to the queue
             std::unique_lock<std::mutex> lk(m_mutex);
@@ -250,8 +428,11 @@ void Thread::Process()
                 continue;
 
             // Get highest priority message within queue
-            msg = m_queue.top();
-            m_queue.pop();
+            std::pop_heap(m_queue.begin(), m_queue.end(), ThreadMsgComparator());
+            msg.emplace(std::move(m_queue.back()));
+            m_queue.pop_back();
+            m_stats.RecordDequeue(std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - msg->GetEnqueueTime()), m_queue.size());
         }
 
         switch (msg->GetId())
@@ -267,8 +448,23 @@ void Thread::Process()
                 auto invoker = delegateMsg->GetInvoker();
                 ASSERT_TRUE(invoker);
 
-                // Invoke the delegate destination target function
-                bool success = invoker->Invoke(delegateMsg);
+                // Discard stale messages that missed their deadline
+                if (delegateMsg->IsExpired(Clock::now()))
+                {
+                    m_stats.RecordExpired(msg->GetPriority());
+                    LOG_INFO("Thread::Process Expired {}", THREAD_NAME);
+                    break;
+                }
+
+                // Invoke the delegate destination target function. Record the 
+                // executing target for watchdog stall diagnostics.
+                auto startTime = Clock::now();
+                m_invokeStartTime.store(Timer::GetNow());
+                m_currentTarget.store(&delegateMsg->GetTargetType(), memory_order_release);
+                bool success = invoker->Invoke(*delegateMsg);
+                m_currentTarget.store(nullptr, memory_order_release);
+                m_stats.RecordInvoke(msg->GetPriority(), std::chrono::duration_cast<std::chrono::microseconds>(
+                    Clock::now() - startTime), delegateMsg->GetTargetType());
                 ASSERT_TRUE(success);
                 break;
             }
@@ -7,18 +7,82 @@
 #include "delegate/IThread.h"
 #include "./predef/util/Timer.h"
 #include "ThreadMsg.h"
+#include "ThreadStats.h"
 #include <thread>
-#include <queue>
+#include <vector>
+#include <algorithm>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
 #include <future>
 #include <optional>
 
-// Comparator for priority queue
+/// @brief Scheduling options applied to the worker thread by `Thread::CreateThread()`.
+/// @details Options not supported by the platform are ignored. Real-time policies and
+/// negative nice levels usually require elevated privileges (e.g. CAP_SYS_NICE on Linux).
+struct ThreadOptions
+{
+    /// Scheduling policy for the worker thread
+    enum class Policy
+    {
+        DEFAULT,    ///< Platform default (SCHED_OTHER on Linux)
+        FIFO,       ///< Real-time first-in first-out (SCHED_FIFO)
+        RR          ///< Real-time round-robin (SCHED_RR)
+    };
+
+    /// Optional watchdog timeout. See `Thread::CreateThread()`.
+    std::optional<dmq::Duration> watchdogTimeout;
+
+    /// CPU indexes the worker thread may run on. Empty allows any CPU.
+    std::vector<int> cpuAffinity;
+
+    /// Scheduling policy
+    Policy policy = Policy::DEFAULT;
+
+    /// Real-time priority used with FIFO or RR policies (1 to 99 on Linux). On 
+    /// Windows, the value passed to SetThreadPriority() for any policy.
+    int priority = 0;
+
+    /// Optional nice level (-20 to 19) used with the DEFAULT policy. Linux only.
+    std::optional<int> niceLevel;
+};
+
+/// @brief Watchdog stall details passed to `Thread::StallDetected` subscribers.
+struct ThreadStallInfo
+{
+    /// Name of the stalled thread
+    std::string threadName;
+
+    /// Type name of the delegate invoker executing when the stall began, or nullptr
+    /// if the thread was not executing a delegate target.
+    const char* target = nullptr;
+
+    /// Time since the thread last ran its message loop
+    dmq::Duration stallTime = dmq::Duration(0);
+
+    /// Time the target has been executing. Zero if target is nullptr.
+    dmq::Duration invokeTime = dmq::Duration(0);
+
+    /// Number of messages waiting behind the stalled target
+    size_t queueSize = 0;
+};
+
+/// @brief Action taken by the watchdog when a stalled thread is detected.
+enum class WatchdogAction
+{
+    LOG,    ///< Log the stall and notify StallDetected subscribers (default)
+    ABORT   ///< As LOG, then log the queued messages and call FaultHandler()
+};
+
+// Comparator for priority queue. Highest priority first, then earliest deadline 
+// first, then first-in first-out.
 struct ThreadMsgComparator {
-    bool operator()(const std::shared_ptr<ThreadMsg>& a, const std::shared_ptr<ThreadMsg>& b) const {
-        return static_cast<int>(a->GetPriority()) < static_cast<int>(b->GetPriority());
+    bool operator()(const ThreadMsg& a, const ThreadMsg& b) const {
+        if (a.GetPriority() != b.GetPriority())
+            return static_cast<int>(a.GetPriority()) < static_cast<int>(b.GetPriority());
+        if (a.GetDeadline() != b.GetDeadline())
+            return a.GetDeadline() > b.GetDeadline();
+        return a.GetSequence() > b.GetSequence();
     }
 };
 
@@ -37,9 +101,16 @@ struct ThreadMsgComparator {
 /// This ensures that any user thread becoming unresponsive can still be detected,
 /// since WatchdogCheck() runs at a higher priority. For mission-critical systems,
 /// a hardware watchdog should also be used as a fail-safe.
+///
+/// When a stall is detected, StallDetected is invoked once per stall with the
+/// delegate invoker that was executing and how long it has been running.
 class Thread : public dmq::IThread
 {
 public:
+    /// Watchdog stall event. Invoked on the Timer::ProcessTimers() thread once
+    /// each time the thread becomes unresponsive.
+    dmq::MulticastDelegateSafe<void(const ThreadStallInfo&)> StallDetected;
+
     /// Constructor
     Thread(const std::string& threadName);
 
@@ -52,6 +123,12 @@ public:
     /// @return TRUE if thread is created. FALSE otherise. 
     bool CreateThread(std::optional<dmq::Duration> watchdogTimeout = std::nullopt);
 
+    /// Called once to create the worker thread with CPU affinity and scheduling
+    /// options. The thread is created and runs even if an option cannot be applied.
+    /// @param[in] options - the watchdog and scheduling options.
+    /// @return TRUE if thread is created and all options applied. FALSE otherwise.
+    bool CreateThread(const ThreadOptions& options);
+
     /// Called once at program exit to shut down the worker thread
     void ExitThread();
 
@@ -64,13 +141,25 @@ public:
     /// Get thread name
     std::string GetThreadName() { return THREAD_NAME; }
 
-    /// Get size of thread message queue.
+    /// Get size of thread message queue. Does not lock the queue.
     size_t GetQueueSize();
 
+    /// Get a copy of the runtime metrics (queue latency, invoke time, queue 
+    /// depth and message counts). Safe to call from any thread.
+    /// @return The metrics snapshot.
+    ThreadStatsSnapshot GetStats() const { return m_stats.GetSnapshot(); }
+
+    /// Clear the runtime metrics. Safe to call from any thread.
+    void ResetStats() { m_stats.Reset(); }
+
+    /// Set the action taken when the watchdog detects a stall.
+    /// @param[in] action - the watchdog action. Default is WatchdogAction::LOG.
+    void SetWatchdogAction(WatchdogAction action) { m_watchdogAction = action; }
+
     /// Dispatch and invoke a delegate target on the destination thread.
     /// @param[in] msg - Delegate message containing target function 
     /// arguments.
-    virtual void DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg);
+    virtual void DispatchDelegate(dmq::DelegateMsgPtr msg);
 
 private:
     Thread(const Thread&) = delete;
@@ -81,6 +170,10 @@ private:
 
     void SetThreadName(std::thread::native_handle_type handle, const std::string& name);
 
+    /// Apply m_options to the calling thread. Called by the worker thread.
+    /// @return TRUE if all options applied. FALSE otherwise.
+    bool ApplyThreadOptions();
+
     /// Check watchdog is expired. This function is called by the thread 
     /// the calls Timer::ProcessTimers(). This function is thread-safe.
     /// In a real-time OS, Timer::ProcessTimers() typically is called by the highest
@@ -93,17 +186,25 @@ private:
     /// other user delegate events to be handled.
     void ThreadCheck();
 
+    /// Log the queued messages without blocking. Called by WatchdogCheck().
+    void DumpQueue();
+
     std::unique_ptr<std::thread> m_thread;
-    std::priority_queue<std::shared_ptr<ThreadMsg>,
-        std::vector<std::shared_ptr<ThreadMsg>>,
-        ThreadMsgComparator> m_queue;
+    // Priority queue heap ordered by ThreadMsgComparator using std::push_heap() and 
+    // std::pop_heap(). Messages are stored by value. The storage grows to the peak 
+    // depth and is reused, so queuing does not allocate in steady state.
+    std::vector<ThreadMsg> m_queue;
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    uint64_t m_sequence = 0;
     const std::string THREAD_NAME;
 
     // Promise and future to synchronize thread start
-    std::promise<void> m_threadStartPromise;
-    std::future<void> m_threadStartFuture;
+    // Promise value is the result of applying m_options.
+    std::promise<bool> m_threadStartPromise;
+    std::future<bool> m_threadStartFuture;
+
+    ThreadOptions m_options;
 
     std::atomic<bool> m_exit;
 
@@ -114,6 +215,16 @@ private:
     std::unique_ptr<Timer> m_threadTimer;
     dmq::ScopedConnection m_threadTimerConn;
     std::atomic<dmq::Duration> m_watchdogTimeout;
+    std::atomic<WatchdogAction> m_watchdogAction = WatchdogAction::LOG;
+    std::atomic<bool> m_stalled = false;
+
+    // Delegate invoker type currently executing and its start time. 
+    // m_currentTarget is nullptr when no target is executing.
+    std::atomic<const std::type_info*> m_currentTarget = nullptr;
+    std::atomic<dmq::TimePoint> m_invokeStartTime;
+
+    // Runtime metrics
+    ThreadStats m_stats;
 };
 
 #endif 
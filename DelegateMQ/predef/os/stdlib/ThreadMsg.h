@@ -2,7 +2,7 @@
 #define _THREAD_MSG_H
 
 /// @brief A class to hold a platform-specific thread messsage that will be passed 
-/// through the OS message queue. 
+/// through the OS message queue. Move-only; the message owns the delegate message.
 class ThreadMsg
 {
 public:
@@ -13,26 +13,41 @@ public:
 	/// @pre The data pointer argument *must* be created on the heap.
 	/// @post The destination thread will delete the heap allocated data once the 
 	///		callback is complete.  
-	ThreadMsg(int id, std::shared_ptr<dmq::DelegateMsg> data) :
+	ThreadMsg(int id, dmq::DelegateMsgPtr data) :
 		m_id(id), 
-		m_data(data)
+		m_data(std::move(data)),
+		m_enqueueTime(dmq::Clock::now())
 	{
+		// Cache the deadline for the queue comparator. No deadline sorts last.
+		auto deadline = m_data ? m_data->GetDeadline() : std::nullopt;
+		m_deadline = deadline.value_or(dmq::Clock::time_point::max());
 	}
 
 	int GetId() const { return m_id; } 
 
-    std::shared_ptr<dmq::DelegateMsg> GetData() const { return m_data; }
+	/// Get the delegate message. Owned by this message.
+	dmq::DelegateMsg* GetData() const { return m_data.get(); }
 
 	dmq::Priority GetPriority() const {
 		return m_data ? m_data->GetPriority() : dmq::Priority::NORMAL;
 	}
 
+	/// Get the time the message was created for queuing
+	dmq::Clock::time_point GetEnqueueTime() const { return m_enqueueTime; }
+
+	/// Get the message deadline. Clock::time_point::max() if none.
+	dmq::Clock::time_point GetDeadline() const { return m_deadline; }
+
+	/// Get and set the queue insertion order used to keep equal messages FIFO
+	uint64_t GetSequence() const { return m_sequence; }
+	void SetSequence(uint64_t sequence) { m_sequence = sequence; }
+
 private:
 	int m_id;
-    std::shared_ptr<dmq::DelegateMsg> m_data;
-
-	// Use fixed-block memory allocator if DMQ_ALLOCATOR set
-	XALLOCATOR
+	dmq::DelegateMsgPtr m_data;
+	dmq::Clock::time_point m_enqueueTime;
+	dmq::Clock::time_point m_deadline;
+	uint64_t m_sequence = 0;
 };
 
 #endif
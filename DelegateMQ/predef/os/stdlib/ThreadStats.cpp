@@ -0,0 +1,194 @@
+#include "ThreadStats.h"
+
+using namespace std;
+using namespace dmq;
+
+//----------------------------------------------------------------------------
+// UpdateMax
+//----------------------------------------------------------------------------
+template <typename T>
+static bool UpdateMax(std::atomic<T>& current, T value)
+{
+    T prev = current.load(memory_order_relaxed);
+    while (value > prev)
+    {
+        if (current.compare_exchange_weak(prev, value, memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------
+// ThreadHistogram::Record
+//----------------------------------------------------------------------------
+bool ThreadHistogram::Record(std::chrono::microseconds duration)
+{
+    uint64_t us = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+
+    // Bucket index is the bit width of the sample value
+    size_t bucket = 0;
+    for (uint64_t v = us; v != 0 && bucket < BUCKETS - 1; v >>= 1)
+        bucket++;
+
+    m_buckets[bucket].fetch_add(1, memory_order_relaxed);
+    m_count.fetch_add(1, memory_order_relaxed);
+    m_totalUs.fetch_add(us, memory_order_relaxed);
+    return UpdateMax(m_maxUs, us);
+}
+
+//----------------------------------------------------------------------------
+// ThreadHistogram::GetSnapshot
+//----------------------------------------------------------------------------
+ThreadHistogram::Snapshot ThreadHistogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+    for (size_t i = 0; i < BUCKETS; i++)
+        snapshot.buckets[i] = m_buckets[i].load(memory_order_relaxed);
+    snapshot.count = m_count.load(memory_order_relaxed);
+    snapshot.totalUs = m_totalUs.load(memory_order_relaxed);
+    snapshot.maxUs = m_maxUs.load(memory_order_relaxed);
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------
+// ThreadHistogram::Reset
+//----------------------------------------------------------------------------
+void ThreadHistogram::Reset()
+{
+    for (auto& bucket : m_buckets)
+        bucket.store(0, memory_order_relaxed);
+    m_count.store(0, memory_order_relaxed);
+    m_totalUs.store(0, memory_order_relaxed);
+    m_maxUs.store(0, memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// ThreadHistogram::GetBucketLimitUs
+//----------------------------------------------------------------------------
+uint64_t ThreadHistogram::GetBucketLimitUs(size_t bucket)
+{
+    if (bucket >= BUCKETS - 1)
+        return UINT64_MAX;
+    return uint64_t(1) << bucket;
+}
+
+//----------------------------------------------------------------------------
+// ThreadHistogram::Snapshot::PercentileUs
+//----------------------------------------------------------------------------
+uint64_t ThreadHistogram::Snapshot::PercentileUs(double percentile) const
+{
+    if (count == 0)
+        return 0;
+
+    uint64_t target = static_cast<uint64_t>(count * (percentile / 100.0));
+    uint64_t sum = 0;
+    for (size_t i = 0; i < BUCKETS; i++)
+    {
+        sum += buckets[i];
+        if (sum > target || sum == count)
+            return (i == BUCKETS - 1) ? maxUs : GetBucketLimitUs(i);
+    }
+    return maxUs;
+}
+
+//----------------------------------------------------------------------------
+// ThreadStatsSnapshot::MsgsPerSec
+//----------------------------------------------------------------------------
+double ThreadStatsSnapshot::MsgsPerSec(dmq::Priority priority) const
+{
+    auto elapsed = std::chrono::duration<double>(time - startTime).count();
+    if (elapsed <= 0.0)
+        return 0.0;
+    return invoked[ThreadStats::ToIndex(priority)] / elapsed;
+}
+
+//----------------------------------------------------------------------------
+// ToIndex
+//----------------------------------------------------------------------------
+size_t ThreadStats::ToIndex(dmq::Priority priority)
+{
+    size_t index = static_cast<size_t>(priority);
+    return index < ThreadStatsSnapshot::PRIORITIES ? index : static_cast<size_t>(Priority::NORMAL);
+}
+
+//----------------------------------------------------------------------------
+// RecordEnqueue
+//----------------------------------------------------------------------------
+void ThreadStats::RecordEnqueue(dmq::Priority priority, size_t queueDepth)
+{
+    m_enqueued[ToIndex(priority)].fetch_add(1, memory_order_relaxed);
+    m_queueDepth.store(queueDepth, memory_order_relaxed);
+    UpdateMax(m_maxQueueDepth, queueDepth);
+}
+
+//----------------------------------------------------------------------------
+// RecordDequeue
+//----------------------------------------------------------------------------
+void ThreadStats::RecordDequeue(std::chrono::microseconds queueLatency, size_t queueDepth)
+{
+    m_queueDepth.store(queueDepth, memory_order_relaxed);
+    m_queueLatency.Record(queueLatency);
+}
+
+//----------------------------------------------------------------------------
+// RecordInvoke
+//----------------------------------------------------------------------------
+void ThreadStats::RecordInvoke(dmq::Priority priority, std::chrono::microseconds invokeTime, const std::type_info& target)
+{
+    m_invoked[ToIndex(priority)].fetch_add(1, memory_order_relaxed);
+
+    // Remember which target produced the longest invoke time
+    bool newMax = m_invokeTime.Record(invokeTime);
+    if (newMax || m_slowestTarget.load(memory_order_relaxed) == nullptr)
+        m_slowestTarget.store(&target, memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// RecordExpired
+//----------------------------------------------------------------------------
+void ThreadStats::RecordExpired(dmq::Priority priority)
+{
+    m_expired[ToIndex(priority)].fetch_add(1, memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// GetSnapshot
+//----------------------------------------------------------------------------
+ThreadStatsSnapshot ThreadStats::GetSnapshot() const
+{
+    ThreadStatsSnapshot snapshot;
+    snapshot.time = Clock::now();
+    snapshot.startTime = m_startTime.load(memory_order_relaxed);
+    for (size_t i = 0; i < ThreadStatsSnapshot::PRIORITIES; i++)
+    {
+        snapshot.enqueued[i] = m_enqueued[i].load(memory_order_relaxed);
+        snapshot.invoked[i] = m_invoked[i].load(memory_order_relaxed);
+        snapshot.expired[i] = m_expired[i].load(memory_order_relaxed);
+    }
+    snapshot.queueDepth = m_queueDepth.load(memory_order_relaxed);
+    snapshot.maxQueueDepth = m_maxQueueDepth.load(memory_order_relaxed);
+    snapshot.queueLatency = m_queueLatency.GetSnapshot();
+    snapshot.invokeTime = m_invokeTime.GetSnapshot();
+
+    auto slowest = m_slowestTarget.load(memory_order_relaxed);
+    snapshot.slowestTarget = slowest ? slowest->name() : nullptr;
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------
+// Reset
+//----------------------------------------------------------------------------
+void ThreadStats::Reset()
+{
+    m_startTime.store(Clock::now(), memory_order_relaxed);
+    for (size_t i = 0; i < ThreadStatsSnapshot::PRIORITIES; i++)
+    {
+        m_enqueued[i].store(0, memory_order_relaxed);
+        m_invoked[i].store(0, memory_order_relaxed);
+        m_expired[i].store(0, memory_order_relaxed);
+    }
+    m_maxQueueDepth.store(m_queueDepth.load(memory_order_relaxed), memory_order_relaxed);
+    m_queueLatency.Reset();
+    m_invokeTime.Reset();
+    m_slowestTarget.store(nullptr, memory_order_relaxed);
+}
@@ -0,0 +1,161 @@
+#ifndef _THREAD_STATS_H
+#define _THREAD_STATS_H
+
+/// @file
+/// @brief Runtime metrics collected by a `Thread` instance.
+///
+/// @details All counters are updated by the producer and worker threads using relaxed
+/// atomic operations and may be read from any thread without taking the `Thread` queue
+/// lock. `GetSnapshot()` copies each counter individually, so a snapshot taken while
+/// messages are flowing is not an atomic cut across all fields.
+
+#include "delegate/DelegateMsg.h"
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <typeinfo>
+
+/// @brief A latency histogram with power-of-two microsecond buckets. Bucket 0 counts
+/// samples under 1us, bucket N counts samples in [2^(N-1), 2^N) us and the last
+/// bucket counts everything longer.
+class ThreadHistogram
+{
+public:
+    static constexpr size_t BUCKETS = 24;
+
+    /// A plain copy of the histogram counters.
+    struct Snapshot
+    {
+        std::array<uint64_t, BUCKETS> buckets = {};
+        uint64_t count = 0;
+        uint64_t totalUs = 0;
+        uint64_t maxUs = 0;
+
+        /// Get the mean sample value.
+        /// @return The mean in microseconds, or 0 if no samples.
+        double MeanUs() const { return count ? static_cast<double>(totalUs) / count : 0.0; }
+
+        /// Get an approximate percentile using the bucket upper limits.
+        /// @param[in] percentile - a value between 0.0 and 100.0
+        /// @return The upper limit of the bucket containing the percentile in microseconds.
+        uint64_t PercentileUs(double percentile) const;
+    };
+
+    /// Add a sample to the histogram.
+    /// @param[in] duration - the sample duration
+    /// @return `true` if the sample is a new maximum.
+    bool Record(std::chrono::microseconds duration);
+
+    /// Copy the current counters.
+    Snapshot GetSnapshot() const;
+
+    /// Clear all counters.
+    void Reset();
+
+    /// Get the exclusive upper limit of a bucket.
+    /// @param[in] bucket - the bucket index
+    /// @return The bucket limit in microseconds.
+    static uint64_t GetBucketLimitUs(size_t bucket);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> m_buckets = {};
+    std::atomic<uint64_t> m_count = 0;
+    std::atomic<uint64_t> m_totalUs = 0;
+    std::atomic<uint64_t> m_maxUs = 0;
+};
+
+/// @brief A point-in-time copy of the `Thread` metrics.
+struct ThreadStatsSnapshot
+{
+    static constexpr size_t PRIORITIES = 3;
+
+    /// Time the snapshot was taken and the time counting started
+    dmq::Clock::time_point time;
+    dmq::Clock::time_point startTime;
+
+    /// Messages enqueued and invoked, indexed by `dmq::Priority`
+    std::array<uint64_t, PRIORITIES> enqueued = {};
+    std::array<uint64_t, PRIORITIES> invoked = {};
+
+    /// Messages discarded because their deadline passed, indexed by `dmq::Priority`
+    std::array<uint64_t, PRIORITIES> expired = {};
+
+    /// Current and maximum observed queue depth
+    size_t queueDepth = 0;
+    size_t maxQueueDepth = 0;
+
+    /// Time a message waited in the queue before the worker thread dequeued it
+    ThreadHistogram::Snapshot queueLatency;
+
+    /// Time spent executing the delegate target function
+    ThreadHistogram::Snapshot invokeTime;
+
+    /// Type name of the delegate invoker with the longest single invoke time,
+    /// or nullptr if none. Use to locate head-of-line blocking targets.
+    const char* slowestTarget = nullptr;
+
+    /// Get the average invoked message rate for a priority since the start time.
+    /// @param[in] priority - the message priority
+    /// @return Messages per second
+    double MsgsPerSec(dmq::Priority priority) const;
+};
+
+/// @brief Lock-free runtime metrics for a single `Thread` instance.
+class ThreadStats
+{
+public:
+    ThreadStats() { Reset(); }
+
+    /// Called by the dispatching thread after a message is queued.
+    /// @param[in] priority - the message priority
+    /// @param[in] queueDepth - the queue depth after the message was added
+    void RecordEnqueue(dmq::Priority priority, size_t queueDepth);
+
+    /// Called by the worker thread after a message is removed from the queue.
+    /// @param[in] queueLatency - time between enqueue and dequeue
+    /// @param[in] queueDepth - the queue depth after the message was removed
+    void RecordDequeue(std::chrono::microseconds queueLatency, size_t queueDepth);
+
+    /// Called by the worker thread after a delegate target function returns.
+    /// @param[in] priority - the message priority
+    /// @param[in] invokeTime - time spent executing the target
+    /// @param[in] target - the invoker type, used to identify slow targets
+    void RecordInvoke(dmq::Priority priority, std::chrono::microseconds invokeTime, const std::type_info& target);
+
+    /// Called by the worker thread when an expired message is discarded.
+    /// @param[in] priority - the message priority
+    void RecordExpired(dmq::Priority priority);
+
+    /// Called when the queue is discarded at thread exit.
+    void RecordQueueClear() { m_queueDepth.store(0, std::memory_order_relaxed); }
+
+    /// Get the current queue depth without locking the queue.
+    size_t GetQueueDepth() const { return m_queueDepth.load(std::memory_order_relaxed); }
+
+    /// Copy all counters.
+    ThreadStatsSnapshot GetSnapshot() const;
+
+    /// Clear all counters and restart the rate measurement interval.
+    void Reset();
+
+private:
+    ThreadStats(const ThreadStats&) = delete;
+    ThreadStats& operator=(const ThreadStats&) = delete;
+
+    friend struct ThreadStatsSnapshot;
+
+    static size_t ToIndex(dmq::Priority priority);
+
+    std::atomic<dmq::Clock::time_point> m_startTime;
+    std::array<std::atomic<uint64_t>, ThreadStatsSnapshot::PRIORITIES> m_enqueued = {};
+    std::array<std::atomic<uint64_t>, ThreadStatsSnapshot::PRIORITIES> m_invoked = {};
+    std::array<std::atomic<uint64_t>, ThreadStatsSnapshot::PRIORITIES> m_expired = {};
+    std::atomic<size_t> m_queueDepth = 0;
+    std::atomic<size_t> m_maxQueueDepth = 0;
+    ThreadHistogram m_queueLatency;
+    ThreadHistogram m_invokeTime;
+    std::atomic<const std::type_info*> m_slowestTarget = nullptr;
+};
+
+#endif
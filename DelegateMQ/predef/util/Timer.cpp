@@ -1,19 +1,26 @@
 #include "Timer.h"
 #include "Fault.h"
 #include <chrono>
-#include <algorithm>
 
 using namespace std;
 using namespace dmq;
 
-bool Timer::m_timerStopped = false;
-
 //------------------------------------------------------------------------------
-// TimerDisabled
+// LowestSlot
 //------------------------------------------------------------------------------
-static bool TimerDisabled (Timer* value)
+static int LowestSlot(uint64_t bits)
 {
-    return !(value->Enabled());
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    int slot = 0;
+    while ((bits & 1) == 0)
+    {
+        bits >>= 1;
+        slot++;
+    }
+    return slot;
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -23,6 +30,7 @@ Timer::Timer()
 {
     const std::lock_guard<std::recursive_mutex> lock(GetLock());
     m_enabled = false;
+    m_link.timer = this;
     Expired = dmq::MakeSignal<void(void)>();
 }
 
@@ -33,15 +41,7 @@ Timer::~Timer()
 {
     try {
         const std::lock_guard<std::recursive_mutex> lock(GetLock());
-        auto& timers = GetTimers();
-
-        if (timers.size() != 0) {
-            // Safely check before removing
-            auto it = std::find(timers.begin(), timers.end(), this);
-            if (it != timers.end()) {
-                timers.erase(it);
-            }
-        }
+        Unlink();
     }
     catch (...) {
         // Failsafe during static destruction
@@ -63,16 +63,16 @@ void Timer::Start(dmq::Duration timeout, bool once)
     m_expireTime = GetNow() + m_timeout;
     m_enabled = true;
 
-    // If 'this' is the 'next' item in the ProcessTimers loop, removing it 
-    // invalidates the iterator and causes a crash.
-    auto& timers = GetTimers();
-    bool found = (std::find(timers.begin(), timers.end(), this) != timers.end());
+    // Restarting a running timer moves it to the slot for the new expiration
+    Unlink();
+    Schedule();
 
-    // Only add if not already in the list. 
-    // If it IS in the list (even if disabled/stopped), we just updated 
-    // its state above, so it is now active again.
-    if (!found) 
-        timers.push_back(this);    
+#if defined(DMQ_THREAD_STDLIB)
+    // Wake the timer thread if sleeping past the new expiration
+    auto& wheel = GetWheel();
+    if (m_expireTime.time_since_epoch().count() < wheel.wakeTick)
+        wheel.wakeup.notify_one();
+#endif
 
     LOG_INFO("Timer::Start timeout={}", m_timeout.count());
 }
@@ -86,29 +86,91 @@ void Timer::Stop()
 
     m_enabled = false;
 
-    // Don't remove immediately! Just set a flag.
-    // Let ProcessTimers() handle the actual removal safely using remove_if
-    m_timerStopped = true;
+    // Safe during ProcessTimers(); every list is intrusive
+    Unlink();
 
     LOG_INFO("Timer::Stop timeout={}", m_timeout.count());
 }
 
+//------------------------------------------------------------------------------
+// Link
+//------------------------------------------------------------------------------
+void Timer::Link(TimerLink& head, int level, int slot)
+{
+    m_link.prev = head.prev;
+    m_link.next = &head;
+    head.prev->next = &m_link;
+    head.prev = &m_link;
+    m_level = level;
+    m_slot = slot;
+}
+
+//------------------------------------------------------------------------------
+// Unlink
+//------------------------------------------------------------------------------
+void Timer::Unlink()
+{
+    if (m_level == NOT_LINKED)
+        return;
+
+    TimerLink* next = m_link.next;
+    m_link.prev->next = next;
+    next->prev = m_link.prev;
+    m_link.prev = m_link.next = &m_link;
+
+    // Clear the occupied bit once the wheel slot is empty
+    if (m_level != IN_LIST)
+    {
+        auto& wheel = GetWheel();
+        if (wheel.slots[m_level][m_slot].Empty())
+            wheel.occupied[m_level] &= ~(uint64_t(1) << m_slot);
+    }
+    m_level = NOT_LINKED;
+}
+
+//------------------------------------------------------------------------------
+// Schedule
+//------------------------------------------------------------------------------
+void Timer::Schedule()
+{
+    auto& wheel = GetWheel();
+    const int64_t expire = m_expireTime.time_since_epoch().count();
+
+    if (expire <= wheel.tick)
+    {
+        Link(wheel.due, IN_LIST, 0);
+        return;
+    }
+
+    // The level is the highest base 64 digit where the expiration and current tick differ
+    const uint64_t diff = uint64_t(expire) ^ uint64_t(wheel.tick);
+    int level = 0;
+    while (level + 1 < TimerWheel::LEVELS && (diff >> (TimerWheel::SLOT_BITS * (level + 1))) != 0)
+        level++;
+
+    const int slot = int((uint64_t(expire) >> (TimerWheel::SLOT_BITS * level)) & (TimerWheel::SLOTS - 1));
+    Link(wheel.slots[level][slot], level, slot);
+    wheel.occupied[level] |= uint64_t(1) << slot;
+}
+
 //------------------------------------------------------------------------------
 // CheckExpired
 //------------------------------------------------------------------------------
-void Timer::CheckExpired()
+void Timer::CheckExpired(TimerLink& rearm)
 {
     if (!m_enabled)
         return;
 
     // Has the timer expired?
     if (GetNow() < m_expireTime)
+    {
+        Schedule();
         return;     // Not expired yet
+    }
 
     if (m_once)
     {
         m_enabled = false;
-        m_timerStopped = true;
     }
     else
     {
@@ -127,6 +189,10 @@ void Timer::CheckExpired()
             // frequently enough. 
             LOG_INFO("Timer::CheckExpired Timer Processing Falling Behind");
         }
+
+        // Reschedule once processing completes so the timer expires at most 
+        // once per ProcessTimers() call
+        Link(rearm, IN_LIST, 0);
     }
 
     // Call the client's expired callback function
@@ -135,36 +201,163 @@ void Timer::CheckExpired()
     }
 }
 
+//------------------------------------------------------------------------------
+// NextSlot
+//------------------------------------------------------------------------------
+bool Timer::NextSlot(int& level, int64_t& tick)
+{
+    // Occupied slots always follow the current tick digit, so the lowest 
+    // occupied slot at each level is the next one.
+    auto& wheel = GetWheel();
+    level = -1;
+    for (int l = 0; l < TimerWheel::LEVELS; l++)
+    {
+        if (wheel.occupied[l] == 0)
+            continue;
+        const int shift = TimerWheel::SLOT_BITS * (l + 1);
+        const uint64_t base = shift >= 64 ? 0 : (uint64_t(wheel.tick) >> shift) << shift;
+        const int64_t slotTick = int64_t(base | (uint64_t(LowestSlot(wheel.occupied[l])) << (TimerWheel::SLOT_BITS * l)));
+        if (level < 0 || slotTick < tick)
+        {
+            level = l;
+            tick = slotTick;
+        }
+    }
+    return level >= 0;
+}
+
 //------------------------------------------------------------------------------
 // ProcessTimers
 //------------------------------------------------------------------------------
 void Timer::ProcessTimers()
 {
     const std::lock_guard<std::recursive_mutex> lock(GetLock());
+    auto& wheel = GetWheel();
+    const int64_t now = GetNow().time_since_epoch().count();
+
+    // Local lists. A callback may stop, restart or delete any timer in either list.
+    TimerLink expiring;
+    TimerLink rearm;
 
-    // Remove disabled timer from the list if stopped
-    if (m_timerStopped)
+    while (true)
     {
-        GetTimers().remove_if(TimerDisabled);
-        m_timerStopped = false;
+        // Invoke all due timers
+        if (!wheel.due.Empty())
+        {
+            expiring.next = wheel.due.next;
+            expiring.prev = wheel.due.prev;
+            expiring.next->prev = &expiring;
+            expiring.prev->next = &expiring;
+            wheel.due.next = wheel.due.prev = &wheel.due;
+
+            while (!expiring.Empty())
+            {
+                Timer* t = expiring.next->timer;
+                t->Unlink();
+                t->CheckExpired(rearm);
+            }
+        }
+
+        int nextLevel;
+        int64_t nextTick;
+        if (!NextSlot(nextLevel, nextTick) || nextTick > now)
+            break;
+
+        // Advance to the slot and cascade its timers to lower levels or the due list
+        wheel.tick = nextTick;
+        TimerLink& slot = wheel.slots[nextLevel][LowestSlot(wheel.occupied[nextLevel])];
+        while (!slot.Empty())
+        {
+            Timer* t = slot.next->timer;
+            t->Unlink();
+            t->Schedule();
+        }
     }
 
-    // Iterate safely handling potential deletion during callback
-    auto it = GetTimers().begin();
-    while (it != GetTimers().end())
+    wheel.tick = now;
+
+    // Reschedule periodic timers. A timer already due expires on the next call.
+    while (!rearm.Empty())
     {
-        Timer* t = *it;
+        Timer* t = rearm.next->timer;
+        t->Unlink();
+        t->Schedule();
+    }
+}
+
+//------------------------------------------------------------------------------
+// GetNextExpiration
+//------------------------------------------------------------------------------
+std::optional<dmq::TimePoint> Timer::GetNextExpiration()
+{
+    const std::lock_guard<std::recursive_mutex> lock(GetLock());
+    auto& wheel = GetWheel();
+
+    if (!wheel.due.Empty())
+        return GetNow();
+
+    // A cascade may precede the actual expiration; no timer expires sooner
+    int level;
+    int64_t tick;
+    if (!NextSlot(level, tick))
+        return std::nullopt;
+    return dmq::TimePoint(dmq::Duration(tick));
+}
+
+#if defined(DMQ_THREAD_STDLIB)
+//------------------------------------------------------------------------------
+// StartTimerThread
+//------------------------------------------------------------------------------
+void Timer::StartTimerThread()
+{
+    const std::lock_guard<std::recursive_mutex> lock(GetLock());
+    auto& wheel = GetWheel();
+    if (wheel.thread.joinable())
+        return;
 
-        // INCREMENT NOW: Move 'it' to the next element BEFORE calling the function
-        // that might delete the current element 't'.
-        it++;
+    wheel.threadExit = false;
+    wheel.thread = std::thread([]() {
+        std::unique_lock<std::recursive_mutex> lock(GetLock());
+        auto& wheel = GetWheel();
+        while (!wheel.threadExit)
+        {
+            ProcessTimers();
 
-        // Now call the function. If 't' destroys itself, it is removed from the list,
-        // but our local 'it' variable is already safe at the next node.
-        if (t != nullptr)
-            t->CheckExpired();
+            // Sleep until the next expiration. Start() wakes the thread early.
+            auto next = GetNextExpiration();
+            wheel.wakeTick = next ? next->time_since_epoch().count() : INT64_MAX;
+            if (wheel.threadExit)
+                break;
+            if (next)
+                wheel.wakeup.wait_until(lock, next.value());
+            else
+                wheel.wakeup.wait(lock);
+            wheel.wakeTick = INT64_MAX;
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+// StopTimerThread
+//------------------------------------------------------------------------------
+void Timer::StopTimerThread()
+{
+    std::thread thread;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(GetLock());
+        auto& wheel = GetWheel();
+        wheel.threadExit = true;
+        wheel.wakeup.notify_all();
+        thread = std::move(wheel.thread);
     }
+
+    // Join outside the lock; the thread takes it to exit
+    if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+        thread.join();
+    else if (thread.joinable())
+        thread.detach();
 }
+#endif
 
 //------------------------------------------------------------------------------
 // GetNow
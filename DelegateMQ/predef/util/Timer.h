@@ -3,11 +3,19 @@
 
 #include "../../delegate/SignalSafe.h"
 #include <mutex>
-#include <list>
+#include <cstdint>
+#include <optional>
+
+#if defined(DMQ_THREAD_STDLIB)
+    #include <condition_variable>
+    #include <thread>
+#endif
 
 /// @brief A timer class provides periodic timer callbacks on the client's 
 /// thread of control. Timer is thread safe.
 /// See example SafeTimer.cpp to prevent a latent callback on a dead object.
+/// Timers are kept in a hierarchical timing wheel; `Start()`, `Stop()` and destruction 
+/// take constant time and `ProcessTimers()` touches only expiring timers.
 class Timer 
 {
 public:
@@ -37,25 +45,111 @@ public:
     static dmq::TimePoint GetNow();
 
     /// Called on a periodic basic to service all timer instances. 
-    /// @TODO: Call periodically for timer expiration handling.
+    /// @TODO: Call periodically for timer expiration handling, or use `StartTimerThread()`.
     static void ProcessTimers();
 
+    /// Get the earliest time a running timer may expire. A thread calling 
+    /// `ProcessTimers()` may sleep until then instead of polling.
+    /// @return The time, or std::nullopt if no timer is running.
+    static std::optional<dmq::TimePoint> GetNextExpiration();
+
+#if defined(DMQ_THREAD_STDLIB)
+    /// Start a thread calling `ProcessTimers()`. The thread sleeps until the next 
+    /// expiration and wakes early when a sooner timer is started, so an idle 
+    /// thread uses no CPU. Timer callbacks are invoked on this thread.
+    static void StartTimerThread();
+
+    /// Stop the thread started by `StartTimerThread()` and wait for it to exit.
+    static void StopTimerThread();
+#endif
+
 private:
     // Prevent inadvertent copying of this object
     Timer(const Timer&);
     Timer& operator=(const Timer&);
 
+    /// Intrusive doubly linked list node. A list head is a node with no timer.
+    struct TimerLink
+    {
+        TimerLink* prev = this;
+        TimerLink* next = this;
+        Timer* timer = nullptr;
+
+        bool Empty() const { return next == this; }
+    };
+
+    /// @brief Hierarchical timing wheel keyed on the expiration time in ticks (milliseconds).
+    /// @details Level L slot S holds the timers whose expiration agrees with the current 
+    /// tick in all base 64 digits above L and has digit S at level L. Once the current tick 
+    /// reaches a level L slot, its timers cascade to a lower level. Timers reaching level 0 
+    /// are due. A bitmap per level locates the next occupied slot, so processing skips 
+    /// empty ticks and touches only expiring timers.
+    struct TimerWheel
+    {
+        static constexpr int SLOT_BITS = 6;
+        static constexpr int SLOTS = 1 << SLOT_BITS;
+
+        /// Enough levels to cover any non-negative 64-bit tick
+        static constexpr int LEVELS = (63 + SLOT_BITS - 1) / SLOT_BITS;
+
+        TimerWheel() : tick(GetNow().time_since_epoch().count()) {}
+
+        /// The timer lists for each level and slot
+        TimerLink slots[LEVELS][SLOTS];
+
+        /// Bit S set if slot S of the level is not empty
+        uint64_t occupied[LEVELS] = {};
+
+        /// Timers expiring at or before the current tick
+        TimerLink due;
+
+        /// The tick the wheel has advanced to
+        int64_t tick;
+
+#if defined(DMQ_THREAD_STDLIB)
+        /// The timer thread and its exit request
+        std::thread thread;
+        bool threadExit = false;
+
+        /// The tick the timer thread sleeps until, or INT64_MAX if not sleeping on a timer
+        int64_t wakeTick = INT64_MAX;
+
+        /// Wakes the timer thread when a sooner timer starts or on exit
+        std::condition_variable_any wakeup;
+#endif
+    };
+
+    /// The `m_level` value of a timer not linked into any list
+    static constexpr int NOT_LINKED = -1;
+
+    /// The `m_level` value of a timer linked into a list outside of the wheel slots
+    static constexpr int IN_LIST = TimerWheel::LEVELS;
+
     /// Called to check for expired timers and callback registered clients.
-    void CheckExpired();
+    /// @param[in] rearm - the list receiving a periodic timer until processing completes.
+    void CheckExpired(TimerLink& rearm);
+
+    /// Insert the timer into the wheel using the expiration time. O(1).
+    void Schedule();
+
+    /// Find the next occupied wheel slot.
+    /// @param[out] level - the slot level.
+    /// @param[out] tick - the tick the current tick reaches the slot.
+    /// @return `false` if the wheel is empty.
+    static bool NextSlot(int& level, int64_t& tick);
 
-    typedef xlist<Timer*>::iterator TimersIterator;
+    /// Link the timer at the end of a list. O(1).
+    void Link(TimerLink& head, int level, int slot);
 
-    /// Get list using the "Immortal" Pattern
-    static xlist<Timer*>& GetTimers()
+    /// Remove the timer from its list, if any. O(1).
+    void Unlink();
+
+    /// Get the timing wheel using the "Immortal" Pattern
+    static TimerWheel& GetWheel()
     {
-        // Allocate on heap and NEVER delete. Prevents lock from being destroyed 
+        // Allocate on heap and NEVER delete. Prevents wheel from being destroyed 
         // before the last Timer destructor runs at app shutdown.
-        static xlist<Timer*>* instance = new xlist<Timer*>();
+        static TimerWheel* instance = new TimerWheel();
         return *instance;
     }
 
@@ -72,7 +166,11 @@ private:
     dmq::TimePoint m_expireTime;
     bool m_enabled = false;
     bool m_once = false;
-    static bool m_timerStopped;
+
+    /// The timer wheel list link and position
+    TimerLink m_link;
+    int m_level = NOT_LINKED;
+    int m_slot = 0;
 };
 
 #endif
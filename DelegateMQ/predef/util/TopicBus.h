@@ -0,0 +1,296 @@
+#ifndef _TOPIC_BUS_H
+#define _TOPIC_BUS_H
+
+#include "DelegateMQ.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+/// @file
+/// @brief An in-process publish/subscribe bus with compile-time typed topics.
+///
+/// @details A topic is a type binding a numeric identifier to a function signature.
+/// Publishers and subscribers name the topic type only, so a signature mismatch is a
+/// compile error instead of a silent miss:
+///
+///     using TemperatureTopic = Topic<1, void(float)>;
+///
+///     TopicBus bus;
+///     dmq::ScopedConnection conn = bus.Subscribe<TemperatureTopic>(
+///         [](float value) { ... }, workerThread);
+///     bus.Publish<TemperatureTopic>(21.5f);
+///
+/// Each topic owns a `SignalSafe` subscriber array created on first use. Topic lookup
+/// indexes a fixed array by identifier with a single atomic load; no lock is taken.
+/// A subscriber registered with a thread is invoked asynchronously on that thread, and
+/// subscribers sharing a thread receive one message per publish (see `BroadcastFusion.h`).
+///
+/// Each topic counts publishes and measures the latency from `Publish()` to each subscriber
+/// invocation. See `GetStats()`.
+
+/// Topic identifier. Must be less than `TopicBus::MAX_TOPICS`.
+using TopicId = std::uint16_t;
+
+template <TopicId Id, class Signature>
+struct Topic; // Not defined
+
+/// @brief Declares a topic with identifier `Id` and signature `void(Args...)`. Two topic
+/// types sharing an identifier must declare the same signature.
+template <TopicId Id, class... Args>
+struct Topic<Id, void(Args...)>
+{
+    static constexpr TopicId ID = Id;
+    using Signature = void(Args...);
+};
+
+/// @brief A snapshot of one topic's statistics
+struct TopicStats
+{
+    /// Number of `Publish()` calls
+    std::uint64_t published = 0;
+
+    /// Number of subscriber invocations
+    std::uint64_t delivered = 0;
+
+    /// Sum and maximum of the `Publish()` to subscriber invocation latency
+    std::chrono::nanoseconds totalLatency{0};
+    std::chrono::nanoseconds maxLatency{0};
+
+    /// Time of the first and last `Publish()` call
+    dmq::Clock::time_point firstPublish;
+    dmq::Clock::time_point lastPublish;
+
+    /// @return The average latency, or zero if nothing was delivered.
+    std::chrono::nanoseconds AverageLatency() const {
+        if (delivered == 0)
+            return std::chrono::nanoseconds(0);
+        return totalLatency / static_cast<std::int64_t>(delivered);
+    }
+
+    /// @return Publishes per second between the first and last publish, or zero
+    /// if fewer than two publishes.
+    double PublishRate() const {
+        std::chrono::duration<double> span = lastPublish - firstPublish;
+        if (published < 2 || span.count() <= 0.0)
+            return 0.0;
+        return static_cast<double>(published - 1) / span.count();
+    }
+};
+
+/// @brief Typed topic publish/subscribe bus. Class is thread safe.
+class TopicBus
+{
+public:
+    /// @TODO Update the maximum number of topic identifiers if necessary.
+    static constexpr std::size_t MAX_TOPICS = 256;
+
+    TopicBus() = default;
+
+    /// Destructor. Outstanding connections become disconnected.
+    ~TopicBus()
+    {
+        for (auto& topic : m_topics)
+            delete topic.load(std::memory_order_acquire);
+    }
+
+    /// Subscribe to a topic. The subscriber is invoked synchronously by the publishing thread.
+    /// @tparam T The topic type.
+    /// @param[in] func - a callable (lambda, std::function or synchronous delegate)
+    /// matching the topic signature.
+    /// @return The connection handle. Wrap in `dmq::ScopedConnection` to unsubscribe
+    /// automatically.
+    template <class T, class F>
+    [[nodiscard]] dmq::Connection Subscribe(F func)
+    {
+        return GetTopic<T>().Connect(std::move(func), nullptr);
+    }
+
+    /// Subscribe to a topic. The subscriber is invoked asynchronously on `thread`.
+    /// @tparam T The topic type.
+    /// @param[in] func - a callable (lambda, std::function or synchronous delegate)
+    /// matching the topic signature.
+    /// @param[in] thread - the thread the subscriber is invoked on.
+    /// @return The connection handle. Wrap in `dmq::ScopedConnection` to unsubscribe
+    /// automatically.
+    template <class T, class F>
+    [[nodiscard]] dmq::Connection Subscribe(F func, dmq::IThread& thread)
+    {
+        return GetTopic<T>().Connect(std::move(func), &thread);
+    }
+
+    /// Publish to all topic subscribers.
+    /// @tparam T The topic type.
+    /// @param[in] args - the arguments passed to each subscriber.
+    template <class T, class... P>
+    void Publish(P&&... args)
+    {
+        auto& topic = GetTopic<T>();
+        auto now = dmq::Clock::now();
+        topic.counters->RecordPublish(now);
+        (*topic.signal)(now, std::forward<P>(args)...);
+    }
+
+    /// Get the number of topic subscribers.
+    /// @tparam T The topic type.
+    template <class T>
+    std::size_t GetSubscriberCount()
+    {
+        return GetTopic<T>().signal->Size();
+    }
+
+    /// Get a snapshot of the topic statistics.
+    /// @tparam T The topic type.
+    template <class T>
+    TopicStats GetStats() const
+    {
+        return GetStats(T::ID);
+    }
+
+    /// Get a snapshot of the topic statistics.
+    /// @param[in] id - the topic identifier.
+    /// @return The statistics, or all zero if the topic is not used.
+    TopicStats GetStats(TopicId id) const
+    {
+        if (id >= MAX_TOPICS)
+            return TopicStats();
+        TopicBase* topic = m_topics[id].load(std::memory_order_acquire);
+        return topic ? topic->counters->Snapshot() : TopicStats();
+    }
+
+private:
+    TopicBus(const TopicBus&) = delete;
+    TopicBus& operator=(const TopicBus&) = delete;
+
+    /// Statistics counters shared by a topic and its subscribers
+    struct TopicCounters
+    {
+        std::atomic<std::uint64_t> published{0};
+        std::atomic<std::uint64_t> delivered{0};
+        std::atomic<std::int64_t> totalLatency{0};
+        std::atomic<std::int64_t> maxLatency{0};
+        std::atomic<std::int64_t> firstPublish{0};
+        std::atomic<std::int64_t> lastPublish{0};
+
+        void RecordPublish(dmq::Clock::time_point now)
+        {
+            std::int64_t ticks = ToNanoseconds(now.time_since_epoch());
+            std::int64_t unset = 0;
+            firstPublish.compare_exchange_strong(unset, ticks, std::memory_order_relaxed);
+            lastPublish.store(ticks, std::memory_order_relaxed);
+            published.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void RecordDelivery(dmq::Clock::time_point publishTime)
+        {
+            std::int64_t latency = ToNanoseconds(dmq::Clock::now() - publishTime);
+            totalLatency.fetch_add(latency, std::memory_order_relaxed);
+            std::int64_t max = maxLatency.load(std::memory_order_relaxed);
+            while (latency > max && !maxLatency.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {}
+            delivered.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        TopicStats Snapshot() const
+        {
+            TopicStats stats;
+            stats.published = published.load(std::memory_order_relaxed);
+            stats.delivered = delivered.load(std::memory_order_relaxed);
+            stats.totalLatency = std::chrono::nanoseconds(totalLatency.load(std::memory_order_relaxed));
+            stats.maxLatency = std::chrono::nanoseconds(maxLatency.load(std::memory_order_relaxed));
+            stats.firstPublish = dmq::Clock::time_point(std::chrono::duration_cast<dmq::Clock::duration>(
+                std::chrono::nanoseconds(firstPublish.load(std::memory_order_relaxed))));
+            stats.lastPublish = dmq::Clock::time_point(std::chrono::duration_cast<dmq::Clock::duration>(
+                std::chrono::nanoseconds(lastPublish.load(std::memory_order_relaxed))));
+            return stats;
+        }
+
+        static std::int64_t ToNanoseconds(dmq::Clock::duration d)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+        }
+    };
+
+    /// Non-template base class for all topics
+    struct TopicBase
+    {
+        explicit TopicBase(const void* id) : typeId(id) {}
+        virtual ~TopicBase() = default;
+
+        /// Identifies the topic signature
+        const void* typeId;
+
+        /// Outlives the topic while async deliveries are queued
+        std::shared_ptr<TopicCounters> counters = std::make_shared<TopicCounters>();
+    };
+
+    template <class Signature>
+    struct TopicEntry; // Not defined
+
+    /// A topic and its subscribers. Each subscriber receives the publish time ahead of
+    /// the topic arguments to measure latency.
+    template <class... Args>
+    struct TopicEntry<void(Args...)> : TopicBase
+    {
+        using SignalType = dmq::SignalSafe<void(dmq::Clock::time_point, Args...)>;
+
+        TopicEntry() : TopicBase(TypeIdOf<TopicEntry>()) {}
+
+        template <class F>
+        dmq::Connection Connect(F func, dmq::IThread* thread)
+        {
+            std::function<void(dmq::Clock::time_point, Args...)> target =
+                [func = std::move(func), counters = this->counters](dmq::Clock::time_point publishTime, Args... args) mutable {
+                    counters->RecordDelivery(publishTime);
+                    func(std::forward<Args>(args)...);
+                };
+            if (thread)
+                return signal->Connect(dmq::MakeDelegate(target, *thread));
+            return signal->Connect(dmq::MakeDelegate(target));
+        }
+
+        std::shared_ptr<SignalType> signal = std::make_shared<SignalType>();
+    };
+
+    /// Get the topic, creating it on first use. Lock-free.
+    template <class T>
+    TopicEntry<typename T::Signature>& GetTopic()
+    {
+        static_assert(T::ID < MAX_TOPICS, "Topic identifier out of range");
+        using EntryType = TopicEntry<typename T::Signature>;
+
+        auto& slot = m_topics[T::ID];
+        TopicBase* topic = slot.load(std::memory_order_acquire);
+        if (!topic)
+        {
+            auto created = new(std::nothrow) EntryType();
+            if (!created)
+                BAD_ALLOC();
+
+            // Another thread may create the topic first; keep the winner
+            if (slot.compare_exchange_strong(topic, created, std::memory_order_acq_rel, std::memory_order_acquire))
+                topic = created;
+            else
+                delete created;
+        }
+
+        // Topic types sharing an identifier must declare the same signature
+        ASSERT_TRUE(topic->typeId == TypeIdOf<EntryType>());
+        return static_cast<EntryType&>(*topic);
+    }
+
+    /// Get a unique identifier for a type without RTTI
+    template <class E>
+    static const void* TypeIdOf()
+    {
+        static const char id = 0;
+        return &id;
+    }
+
+    /// Topics indexed by identifier, or nullptr if not used
+    std::atomic<TopicBase*> m_topics[MAX_TOPICS] = {};
+};
+
+#endif
@@ -12,7 +12,7 @@ class LogData
 {
 public:
 #ifdef IT_ENABLE
-    dmq::MulticastDelegateSafe<void(std::chrono::milliseconds)> FlushTimeDelegate;
+    dmq::MulticastDelegateSnapshot<void(std::chrono::milliseconds)> FlushTimeDelegate;
 #endif
 
     LogData() {}
@@ -40,11 +40,11 @@ private:
 class DelegateMsg : public Msg
 {
 public:
-    DelegateMsg(int id, std::shared_ptr<dmq::DelegateMsg> data) : Msg(id), m_data(data) {}
-    std::shared_ptr<dmq::DelegateMsg> GetMsg() { return m_data; }
+    DelegateMsg(int id, dmq::DelegateMsgPtr data) : Msg(id), m_data(std::move(data)) {}
+    dmq::DelegateMsg* GetMsg() { return m_data.get(); }
 
 private:
-    std::shared_ptr<dmq::DelegateMsg> m_data;
+    dmq::DelegateMsgPtr m_data;
 };
 #endif
 
@@ -157,12 +157,12 @@ void Logger::ExitThread()
 // DispatchDelegate
 //----------------------------------------------------------------------------
 #ifdef IT_ENABLE
-void Logger::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
+void Logger::DispatchDelegate(dmq::DelegateMsgPtr msg)
 {
     ASSERT_TRUE(m_thread);
 
     // Create a new ThreadMsg
-    std::shared_ptr<DelegateMsg> threadMsg(new DelegateMsg(MSG_DISPATCH_DELEGATE, msg));
+    std::shared_ptr<DelegateMsg> threadMsg(new DelegateMsg(MSG_DISPATCH_DELEGATE, std::move(msg)));
 
     // Add dispatch delegate msg to queue and notify worker thread
     std::unique_lock<std::mutex> lk(m_mutex);
@@ -206,6 +206,9 @@ void Logger::Process()
         m_queue.push(m);
         m_queue.pop();
     }
+
+    // Allow coroutines awaiting delegates to resume on this thread
+    SetCurrent();
 #endif
 
     m_timerExit = false;
@@ -272,7 +275,7 @@ void Logger::Process()
             auto delegateMsgBase = delegateMsg->GetMsg();
 
             // Invoke the delegate target function on the target thread context
-            delegateMsgBase->GetInvoker()->Invoke(delegateMsgBase);
+            delegateMsgBase->GetInvoker()->Invoke(*delegateMsgBase);
             break;
         }
 #endif
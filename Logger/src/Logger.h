@@ -37,7 +37,7 @@ public:
     }
 
 #ifdef IT_ENABLE
-    virtual void DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg);
+    virtual void DispatchDelegate(dmq::DelegateMsgPtr msg);
 #endif
 
 private:
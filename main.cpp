@@ -24,35 +24,41 @@
 #ifdef IT_ENABLE
 #include "IntegrationTest.h"
 extern void Logger_IT_ForceLink();
+extern void Timer_IT_ForceLink();
+extern void DelegateAsync_IT_ForceLink();
+extern void Thread_IT_ForceLink();
+extern void MulticastDelegate_IT_ForceLink();
+extern void Signal_IT_ForceLink();
+extern void Future_IT_ForceLink();
+extern void Await_IT_ForceLink();
+extern void AsyncWait_IT_ForceLink();
+extern void TopicBus_IT_ForceLink();
 using namespace dmq;
 #endif
 
 using namespace std;
 
-#ifdef IT_ENABLE
-std::atomic<bool> processTimerExit = false;
-static void ProcessTimers()
-{
-    while (!processTimerExit.load())
-    {
-        // Process all delegate-based timers
-        Timer::ProcessTimers();
-        std::this_thread::sleep_for(std::chrono::microseconds(50));
-    }
-}
-#endif
-
 //------------------------------------------------------------------------------
 // main
 //------------------------------------------------------------------------------
 int main(void)
 {
 #ifdef IT_ENABLE
-    // Start the thread that will run ProcessTimers
-    std::thread timerThread(ProcessTimers);
+    // Start the thread that processes all delegate-based timers. The thread 
+    // sleeps until the next timer expires.
+    Timer::StartTimerThread();
 
-    // Dummy function call to prevent linker from discarding Logger_IT code
+    // Dummy function calls to prevent linker from discarding the IT code
     Logger_IT_ForceLink();
+    Timer_IT_ForceLink();
+    DelegateAsync_IT_ForceLink();
+    Thread_IT_ForceLink();
+    MulticastDelegate_IT_ForceLink();
+    Signal_IT_ForceLink();
+    Future_IT_ForceLink();
+    Await_IT_ForceLink();
+    AsyncWait_IT_ForceLink();
+    TopicBus_IT_ForceLink();
 
     IntegrationTest::GetInstance();
 #endif
@@ -66,9 +72,7 @@ int main(void)
         this_thread::sleep_for(std::chrono::seconds(1));
 
     // Ensure the timer thread completes before main exits
-    processTimerExit.store(true);
-    if (timerThread.joinable())
-        timerThread.join();
+    Timer::StopTimerThread();
 #endif
 
     return 0;